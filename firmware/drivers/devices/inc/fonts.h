@@ -15,6 +15,8 @@
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
  * 
+ * @note Anti-aliased fonts (AAFont_t) created with firmware/tools/font_converter.py
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -22,6 +24,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 16/10/2026 | Anti-aliased 2/4 bpp run length encoded fonts     					|
  * 
  **/
 
@@ -46,6 +49,29 @@ typedef struct{
 	const uint8_t 	*data; 			/*!< Font array */
 } Font_t;
 
+/**
+ * @brief Anti-aliased character information
+ */
+typedef struct{
+	uint8_t width;		/*<! Character width in pixels */
+	uint32_t offset;	/*<! Character position in font array */
+} aa_char_info_t;
+
+/**
+ * @brief  Anti-aliased font structure
+ * 
+ * Each row of a character is run length encoded: every byte is a run of pixels with
+ * the same intensity, (run length - 1) in the upper (8 - bpp) bits and intensity in
+ * the lower bpp bits (0: background, 2^bpp - 1: foreground). Runs never cross rows.
+ */
+typedef struct{
+	uint8_t 				font_height;   	/*!< Font height in pixels */
+	uint8_t 				bpp;   			/*!< Bits per pixel: 2 or 4 */
+	char 					first;   		/*!< First character of the font */
+	char 					last;   		/*!< Last character of the font */
+	const aa_char_info_t 	*info;			/*!< Character info array */
+	const uint8_t 			*data; 			/*!< Font array */
+} AAFont_t;
 /*==================[external data declaration]==============================*/
 /**
  * @brief  11 pixels font height structure
@@ -76,6 +102,10 @@ extern Font_t font_59;
  * @brief  89 pixels font height structure
  */
 extern Font_t font_89;
+/**
+ * @brief  30 pixels font height anti-aliased (4 bpp) structure
+ */
+extern AAFont_t font_aa_30;
 
 /*==================[external functions declaration]=========================*/
 
@@ -33,6 +33,14 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 16/10/2026 | Optional framebuffer with dirty areas flushing |
+ * | 16/10/2026 | Span based lines, circles and SPI stats        |
+ * | 16/10/2026 | One window per line of text                    |
+ * | 16/10/2026 | LRU cache of pre-rendered glyphs               |
+ * | 16/10/2026 | Anti-aliased fonts                             |
+ * | 16/10/2026 | Hardware scrolling strip plot and console      |
+ * | 16/10/2026 | Render task with a queue of draw commands      |
+ * | 16/10/2026 | Compressed images                              |
  *
  */
 
@@ -45,6 +53,7 @@
 /* LCD settings */
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
+#define ILI9341_ASYNC_TEXT_MAX	48		/*!< Maximum length of text posted to the render task (longer text is truncated) */
 #define ILI9341_PIXEL_MAX	76800
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
@@ -80,11 +89,53 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  SPI traffic and glyph cache counters, useful to compare the cost of drawing primitives
+ */
+typedef struct {
+	uint32_t transactions;	/*!< Number of SPI transactions (commands and data blocks) */
+	uint32_t bytes;			/*!< Number of bytes sent (commands, parameters and pixels) */
+	uint32_t glyph_hits;	/*!< Characters found in the glyph cache */
+	uint32_t glyph_misses;	/*!< Characters not found in the glyph cache */
+	uint32_t fills_coalesced;	/*!< Fills posted to the render task and not drawn, because covered by the next one */
+} ili9341_stats_t;
+
+/**
+ * @brief  Strip plot configuration
+ * 
+ * Samples are drawn as lines across the scrolling area (rows in portrait orientations,
+ * columns in landscape ones): each new sample is drawn at the end of the plot and
+ * the rest of the plot scrolls one line.
+ */
+typedef struct {
+	uint16_t start;			/*!< First line of the plot (row in portrait, column in landscape) */
+	uint16_t end;			/*!< Last line of the plot (row in portrait, column in landscape) */
+	uint16_t low;			/*!< First pixel of each line (column in portrait, row in landscape) */
+	uint16_t high;			/*!< Last pixel of each line (column in portrait, row in landscape) */
+	int32_t min;			/*!< Value at the left (portrait) or bottom (landscape) of the plot */
+	int32_t max;			/*!< Value at the right (portrait) or top (landscape) of the plot */
+	uint16_t foreground;	/*!< Trace color (RGB565) */
+	uint16_t background;	/*!< Background color (RGB565) */
+} ili9341_strip_t;
+
+/**
+ * @brief  Compressed RGB565 image
+ * @note   Created with firmware/tools/image_converter.py, which describes the format
+ */
+typedef struct {
+	uint16_t width;			/*!< Width in pixels */
+	uint16_t height;		/*!< Height in pixels */
+	const uint8_t *data;	/*!< Compressed pixels */
+} ili9341_image_t;
 /*==================[external data declaration]==============================*/
+extern const ili9341_image_t esp_edu_pic;	/*!< ESP-EDU splash image (240x320), see esp_edu_pic.c */
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief  		Initializes ILI9341 LCD
+ * @note		Takes two pixel streaming buffers from the DMA pool (see dma_pool_mcu.h),
+ * 				they are given back if the LCD can not be added to the SPI bus
  * @param[in]  	spi_dev: Number of SPI device to control LCD driver
  * @param[in]  	gpio_dc: Number of GPIO pin to use as data/command
  * @param[in]  	gpio_rst: Number of GPIO pin to use as hardware reset
@@ -110,6 +161,9 @@ void ILI9341Fill(uint16_t color);
 
 /**
  * @brief  		Rotates LCD to specific orientation
+ * @note		The scrolling area is reset. An enabled framebuffer keeps its coordinates in
+ * 				the new orientation and is sent whole on next ILI9341Flush(), if it no longer
+ * 				fits the LCD it is disabled (see ILI9341FramebufferDeInit()).
  * @param[in]	orientation: LCD orientation
  * @retval 		None
  */
@@ -141,6 +195,8 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 /**
  * @brief  		Draw an integer on the LCD
+ * @note		Every digit takes the width of the widest digit of the font, so the
+ * 				number keeps its size and position when it is updated
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	num: Number to be displayed
@@ -154,6 +210,8 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
 
 /**
  * @brief  		Draw a string on the LCD
+ * @note		Each line of text is sent on a single window, including the background
+ * 				columns between characters
  * @param[in] 	x: X position of top left corner of first character in string
  * @param[in]  	y: Y position of top left corner of first character in string
  * @param[in]  	str: Pointer to first character
@@ -174,6 +232,29 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
  */
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height);
 
+/**
+ * @brief  		Draw a string with an anti-aliased font on the LCD
+ * @note		Edges of the characters are blended from foreground to background color.
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used anti-aliased font
+ * @param[in]  	foreground: Color for string (RGB565)
+ * @param[in]  	background: Color for string background (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawStringAA(uint16_t x, uint16_t y, char* str, AAFont_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Gets width and height of box with text of an anti-aliased font
+ * @param[in]  	str: Pointer to first character
+ * @param[in] 	font: Pointer to used anti-aliased font
+ * @param[out]	width: Pointer to variable to store width
+ * @param[out]	height: Pointer to variable to store height
+ * @retval 		None
+ */
+void ILI9341GetStringSizeAA(char* str, AAFont_t* font, uint16_t* width, uint16_t* height);
+
 /**
  * @brief  		Draws line on the LCD
  * @param[in]  	x0: X coordinate of starting point
@@ -267,8 +348,229 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a compressed image on the LCD
+ * @note		Images are decoded while they are sent, so they take about half the flash
+ * 				of ILI9341DrawPicture() arrays (less for drawings and logos).
+ * 				Use firmware/tools/image_converter.py to create them.
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	image: Pointer to image
+ * @retval 		None
+ */
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t *image);
+
+/**
+ * @brief  		Enables framebuffer mode on an area of the LCD
+ * @note		While enabled, drawings completely inside the area are stored in RAM and
+ * 				only reach the LCD when ILI9341Flush() is called. Drawings crossing the
+ * 				area border are sent to the LCD right away (and also stored in RAM).
+ * 				The area can be smaller than the LCD to fit the available RAM 
+ * 				(2 bytes/pixel: 150kB for the full LCD). There is a single area: to work on
+ * 				a screen larger than the RAM, draw and flush it one area (tile) at a time,
+ * 				calling ILI9341FramebufferInit() again for each one.
+ * @note		Coordinates refer to the current orientation, call ILI9341Rotate() first.
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @param[in]  	color: Initial color of the area (RGB565), sent on first flush
+ * @retval 		1 when success, 0 when fails (not enough RAM)
+ */
+uint8_t ILI9341FramebufferInit(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Sends to the LCD the framebuffer areas modified since last flush
+ * @retval 		None
+ */
+void ILI9341Flush(void);
+
+/**
+ * @brief  		Disables framebuffer mode and frees its memory
+ * @note		Changes not flushed are lost.
+ * @retval 		None
+ */
+void ILI9341FramebufferDeInit(void);
+
+/**
+ * @brief  		Enables the cache of pre-rendered glyphs used to draw text
+ * @note		Characters are kept already expanded to RGB565 for each font and pair of colors,
+ * 				least recently used ones are discarded when the memory budget is reached.
+ * 				Each glyph takes width * height * 2 bytes (e.g. 22 pixels font digits: ~500 bytes).
+ * @param[in]	budget: Maximum memory for glyphs in bytes (0 disables the cache)
+ * @retval 		None
+ */
+void ILI9341GlyphCacheInit(uint32_t budget);
+
+/**
+ * @brief  		Disables the glyph cache and frees its memory
+ * @retval 		None
+ */
+void ILI9341GlyphCacheDeInit(void);
+
+/**
+ * @brief  		Defines a hardware scrolling area
+ * @note		The LCD only scrolls along its 320 pixels side: rows in portrait orientations,
+ * 				columns in landscape ones. Once scrolled, drawing functions address memory
+ * 				lines instead of positions on the screen, so the area is meant to be used
+ * 				through the strip plot and console functions. Rotating the LCD disables it.
+ * @param[in]  	start: First line of the area (row in portrait, column in landscape)
+ * @param[in]  	end: Last line of the area (row in portrait, column in landscape)
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341ScrollInit(uint16_t start, uint16_t end);
+
+/**
+ * @brief  		Disables the scrolling area, memory is shown as is
+ * @retval 		None
+ */
+void ILI9341ScrollDeInit(void);
+
+/**
+ * @brief  		Defines a strip plot on a scrolling area and clears it
+ * @param[in]  	config: Strip plot configuration
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341StripInit(ili9341_strip_t *config);
+
+/**
+ * @brief  		Adds a sample to the strip plot, only a line of the LCD is drawn
+ * @param[in]  	value: Sample, limited to min ... max range of the plot
+ * @retval 		None
+ */
+void ILI9341StripAdd(int32_t value);
+
+/**
+ * @brief  		Defines a text console on a scrolling area and clears it
+ * @note		Only available in portrait orientations. The area is reduced to
+ * 				a whole number of lines of text.
+ * @param[in]  	start: First row of the console
+ * @param[in]  	end: Last row of the console
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for text (RGB565)
+ * @param[in]  	background: Color for background (RGB565)
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341ConsoleInit(uint16_t start, uint16_t end, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Appends lines of text to the console, previous lines scroll up
+ * @note		Each '\n' starts a new line. Characters that don't fit on a line are discarded, '\r' is ignored and
+ *			characters without glyph (tabs, control characters) are drawn as spaces.
+ * @param[in]  	str: Pointer to first character
+ * @retval 		None
+ */
+void ILI9341ConsolePrint(char* str);
+
+/**
+ * @brief  		Starts the render task, that draws the commands posted by the ILI9341Async functions
+ * @note		The render task owns the LCD: while it runs, only ILI9341Async functions must be called.
+ * 				They only copy the command to a queue (and wait if it is full), so the calling
+ * 				task doesn't wait for the SPI transfers.
+ * @param[in]	queue_length: Maximum number of pending commands
+ * @param[in]	priority: Priority of the render task
+ * @retval 		1 when success, 0 when fails (not enough RAM)
+ */
+uint8_t ILI9341AsyncInit(uint8_t queue_length, uint8_t priority);
+
+/**
+ * @brief  		Posts a filled rectangle to the render task
+ * @note		A fill completely covered by the next posted one is not drawn.
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void ILI9341AsyncFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Posts a line to the render task
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void ILI9341AsyncDrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Posts a string to the render task
+ * @note		The string is copied, up to ILI9341_ASYNC_TEXT_MAX - 1 characters.
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for string (RGB565)
+ * @param[in]  	background: Color for string background (RGB565)
+ * @retval 		None
+ */
+void ILI9341AsyncDrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Posts an integer to the render task
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in] 	num: Number to be displayed
+ * @param[in] 	dig: Number of digits to display
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for char (RGB565)
+ * @param[in]  	background: Color for char background (RGB565)
+ * @retval		None
+ */
+void ILI9341AsyncDrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Posts a sample of the strip plot to the render task
+ * @param[in]  	value: Sample
+ * @retval 		None
+ */
+void ILI9341AsyncStripAdd(int32_t value);
+
+/**
+ * @brief  		Posts text for the console to the render task
+ * @note		The string is copied, up to ILI9341_ASYNC_TEXT_MAX - 1 characters.
+ * @param[in]  	str: Pointer to first character
+ * @retval 		None
+ */
+void ILI9341AsyncConsolePrint(char* str);
+
+/**
+ * @brief  		Posts a framebuffer flush to the render task
+ * @retval 		None
+ */
+void ILI9341AsyncFlush(void);
+
+/**
+ * @brief  		Waits until every command posted before is drawn
+ * @retval 		None
+ */
+void ILI9341AsyncFence(void);
+
+/**
+ * @brief  		Waits for pending commands and stops the render task
+ * @retval 		None
+ */
+void ILI9341AsyncDeInit(void);
+
+/**
+ * @brief  		Gets SPI traffic counters since init or last ILI9341ResetStats()
+ * @param[out]	stats: Pointer to structure to store the counters
+ * @retval 		None
+ */
+void ILI9341GetStats(ili9341_stats_t *stats);
+
+/**
+ * @brief  		Resets SPI traffic counters
+ * @retval 		None
+ */
+void ILI9341ResetStats(void);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
+ * @note	Gives the pixel streaming buffers back to the DMA pool
  * @param	None
  * @retval 	1 when success, 0 when fails
  */
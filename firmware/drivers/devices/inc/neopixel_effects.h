@@ -0,0 +1,138 @@
+#ifndef NEOPIXEL_EFFECTS_H
+#define NEOPIXEL_EFFECTS_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup NeoPixel_Effects NeoPixel_Effects
+ ** @{ */
+
+/** \brief Animated effects for a NeoPixel stripe, refreshed at a fixed frame rate.
+ *
+ * A timer tick wakes the effects task once per frame: the task updates the stripe
+ * colors and sends them with NeoPixelShow(). Effects only change what differs from
+ * the previous frame (a moving segment, a few sparkles, the brightness), and the
+ * rainbow reads its colors from a table built once, so frame cost stays low on long
+ * stripes. NeoPixelEffectsGetStats() reports the time spent on each frame.
+ *
+ * @note The stripe must be initialized with NeoPixelInit() first. While the effects
+ * are in use the stripe works with NeoPixelAutoShow(false).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "neopixel_stripe.h"
+#include "timer_mcu.h"
+/*==================[macros]=================================================*/
+#define NEOPIXEL_SPARKLE_MAX      32          /*> Max qty of pixels lit at once by the sparkle effect */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Effects configuration
+ */
+typedef struct {
+	neopixel_color_t *colors;	/*!< Color array given to NeoPixelInit() */
+	uint16_t len;				/*!< Number of NeoPixels in the stripe */
+	timer_mcu_t timer;			/*!< Timer used for the frame tick */
+	uint8_t fps;				/*!< Frames per second */
+} neopixel_effects_config_t;
+
+/**
+ * @brief Frame time statistics
+ */
+typedef struct {
+	uint32_t frames;			/*!< Frames sent */
+	uint32_t missed;			/*!< Frame ticks lost because the previous frame was not finished */
+	uint32_t last_us;			/*!< Time spent on the last frame (us) */
+	uint32_t max_us;			/*!< Longest frame (us) */
+	uint32_t avg_us;			/*!< Average frame time (us) */
+	uint32_t period_us;			/*!< Frame period (us) */
+} neopixel_effects_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+
+/**
+ * @brief Effects initialization: creates the effects task and sets the frame tick.
+ *
+ * @note The stripe is turned off until an effect is selected.
+ * @param config Effects configuration
+ * @return uint8_t 0 on success, 1 if the stripe is empty or the task can not be created
+ */
+uint8_t NeoPixelEffectsInit(neopixel_effects_config_t *config);
+
+/**
+ * @brief Start the frame tick.
+ *
+ */
+void NeoPixelEffectsStart(void);
+
+/**
+ * @brief Stop the frame tick, the stripe keeps the last frame.
+ *
+ */
+void NeoPixelEffectsStop(void);
+
+/**
+ * @brief Rotating rainbow.
+ *
+ * @param speed Hue advance per frame (65536: one full turn)
+ * @param sat   Color saturation (HSV color model)
+ * @param val   Color value or brightness (HSV color model)
+ * @param reps  Number of repetitions of the rainbow along the stripe
+ */
+void NeoPixelEffectRainbow(uint16_t speed, uint8_t sat, uint8_t val, uint8_t reps);
+
+/**
+ * @brief Segment running along the stripe, one pixel per frame.
+ *
+ * @param color 24 bits color
+ * @param size  Segment length (pixels)
+ */
+void NeoPixelEffectChase(neopixel_color_t color, uint16_t size);
+
+/**
+ * @brief Whole stripe fading in and out.
+ *
+ * @note The effect changes the stripe brightness (NeoPixelBrightness()), other
+ * effects set it back to the maximum.
+ * @param color 24 bits color
+ * @param speed Brightness change per frame (0 is taken as 1)
+ */
+void NeoPixelEffectFade(neopixel_color_t color, uint8_t speed);
+
+/**
+ * @brief Random pixels lit for one frame.
+ *
+ * @param color 24 bits color
+ * @param qty   Pixels lit on each frame (up to NEOPIXEL_SPARKLE_MAX)
+ */
+void NeoPixelEffectSparkle(neopixel_color_t color, uint8_t qty);
+
+/**
+ * @brief Read the frame time statistics.
+ *
+ * @note A frame fits the frame rate while max_us is below period_us. With the RMT
+ * backend leds are sent in background, so a frame only waits for the wire when
+ * the previous frame is still queued (about 30us per led).
+ * @param stats Frame time statistics
+ */
+void NeoPixelEffectsGetStats(neopixel_effects_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,14 @@
  * 
  * @note ESP-EDU have one individual NeoPixel connected to GPIO_8, that can be used with this driver.
  * 
+ * @note Frames are sent in background by the RMT peripheral: functions that update the 
+ * stripe return before the leds are refreshed (see NeoPixelFrameCallback()). If the RMT 
+ * is not available the leds are bit-banged and functions return at the end of the frame.
+ * 
+ * @note By default every change is sent right away. With NeoPixelAutoShow(false) changes 
+ * are only composed in the color array (back buffer) and NeoPixelShow() sends them as 
+ * one frame, while the next one is composed. 
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,6 +29,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 16/10/2026 | Frames sent in background by the RMT									|
+ * | 16/10/2026 | Deferred updates: NeoPixelShow() and NeoPixelAutoShow()				|
  * 
  **/
 
@@ -82,9 +92,19 @@ typedef uint32_t neopixel_color_t;
  */
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array);
 
+/**
+ * @brief Set a function to be called at the end of each frame transmission.
+ * 
+ * @note func_p is called from an ISR, and only with the RMT backend.
+ * @param func_p    Function to be called (NULL to disable)
+ * @param param_p   Parameter passed to func_p
+ */
+void NeoPixelFrameCallback(void (*func_p)(void *param), void *param_p);
+
 /**
  * @brief Turn off all NeoPixels.
  * 
+ * @note Sent right away in both modes, the color array is not changed.
  */
 void NeoPixelAllOff(void);
 
@@ -106,10 +126,27 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color);
 /**
  * @brief Set all NeoPixels in the array with the color stored in an array.
  * 
+ * @note With NeoPixelAutoShow(false) colors are copied into the stripe color array.
  * @param color_array Array of 24 bits color
  */
 void NeoPixelSetArray(neopixel_color_t *color_array);
 
+/**
+ * @brief Send the changes made since the last frame, if any.
+ * 
+ * @note Called once per frame tick by animations, after updating the stripe. 
+ * The stripe can be changed again as soon as this function returns.
+ */
+void NeoPixelShow(void);
+
+/**
+ * @brief Select whether changes are sent right away or only on NeoPixelShow().
+ * 
+ * @note When enabled pending changes are sent.
+ * @param enable true: each change is sent (default), false: changes are sent by NeoPixelShow()
+ */
+void NeoPixelAutoShow(bool enable);
+
 /**
  * @brief Shift the all NeoPixel colors in the array 1 position (up or down)
  * 
@@ -12,6 +12,10 @@
  *
  * @note For handling NeoPixels arrays use "neopixel_stripe.h".
  * 
+ * @note Leds can be driven in two ways: ws2812bSend() times each bit with the CPU 
+ * (interrupts should not preempt it), while the RMT backend (ws2812bInitRmt()) 
+ * sends a whole frame in background and signals the end with a callback.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,20 +23,27 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 16/10/2026 | RMT backend for whole frame transmission								|
+ * | 16/10/2026 | Double frame buffer for the RMT backend								|
+ * | 16/10/2026 | ws2812bSendWord(): send a color already gamma corrected				|
+ * | 16/10/2026 | Parallel output of up to 8 strips										|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define WS2812B_PARALLEL_MAX    8   /*> Max qty of strips driven by ws2812bSendParallel() */
 
 /*==================[typedef]================================================*/
 /**
  * @brief NeoPixel color
  * 
+ * @note Fields are in the order they are sent, so an array of rgb_led_t is a frame.
  */
 typedef struct rgb_led{
 	 uint8_t green;  		// Green
@@ -50,6 +61,31 @@ typedef struct rgb_led{
  */
 void ws2812bInit(gpio_t pin);
 
+/**
+ * @brief Initialization of several NeoPixel strips driven at once (bit-banged).
+ * 
+ * @note ws2812bInit() and this function share the dedicated GPIO bundle, each one 
+ * replaces the output set by the other: after this call ws2812bSend() (and a 
+ * NeoPixel stripe using the bit-banged output) drives the first of these pins 
+ * instead of its own, and ws2812bSendParallel() sends nothing after ws2812bInit().
+ * @param pins  GPIO numbers where each strip data pin (DIN) will be connected
+ * @param qty   Qty of strips (up to WS2812B_PARALLEL_MAX)
+ * @return uint8_t 0 on success, 1 if qty is out of range
+ */
+uint8_t ws2812bInitParallel(gpio_t *pins, uint8_t qty);
+
+/**
+ * @brief Send a frame to every strip set with ws2812bInitParallel() at once.
+ * 
+ * @note Each bit period writes the bit of every strip at the same time, so the 
+ * frame takes the same time as a single strip of len leds.
+ * @note Colors are sent as written, without gamma correction (see ws2812bGammaCorrection()).
+ * @note Nothing is sent unless ws2812bInitParallel() is the last initialization.
+ * @param strips    Array with the leds of each strip (in the order of the pins)
+ * @param len       Qty of leds of each strip
+ */
+void ws2812bSendParallel(rgb_led_t *const strips[], uint16_t len);
+
 /**
  * @brief Send color information to NeoPixel.
  * 
@@ -57,12 +93,68 @@ void ws2812bInit(gpio_t pin);
  */
 void ws2812bSend(rgb_led_t led_color);
 
+/**
+ * @brief Send a 24 bits word to NeoPixel, as is (no gamma correction).
+ * 
+ * @param grb Color bits in the order they are sent: green (bits 23 to 16), red, blue
+ */
+void ws2812bSendWord(uint32_t grb);
+
 /**
  * @brief Send a ret command to NeoPixel.
  * 
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief Gamma correction of a color component, as applied by ws2812bSend().
+ * 
+ * @param component Color level (0 to 255)
+ * @return uint8_t Gamma corrected level
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
+/**
+ * @brief NeoPixel initialization using the RMT peripheral.
+ * 
+ * @param pin       GPIO number where NeoPixel data pin (DIN) will be connected
+ * @param max_leds  Size of each of the two frame buffers (qty of leds)
+ * @return uint8_t 0 on success, 1 if the RMT channel or the frame buffer are not available
+ */
+uint8_t ws2812bInitRmt(gpio_t pin, uint16_t max_leds);
+
+/**
+ * @brief Release the RMT channel and the frame buffer.
+ * 
+ */
+void ws2812bDeInitRmt(void);
+
+/**
+ * @brief Get the back frame buffer, to be filled while the other one is sent.
+ * 
+ * @note Only waits if both frame buffers are still queued for transmission. 
+ * The same buffer is returned until ws2812bFrameSend() is called.
+ * @note Colors are sent as written, without gamma correction (see ws2812bGammaCorrection()).
+ * @return rgb_led_t* Frame buffer (NULL if the RMT backend is not initialized)
+ */
+rgb_led_t *ws2812bFrameBuffer(void);
+
+/**
+ * @brief Send the back frame buffer (followed by a ret command) in background, 
+ * the other buffer becomes the back buffer.
+ * 
+ * @param len       Qty of leds to send
+ * @param func_p    Function called (from an ISR) at the end of the frame (can be NULL)
+ * @param param_p   Parameter passed to func_p
+ */
+void ws2812bFrameSend(uint16_t len, void (*func_p)(void *param), void *param_p);
+
+/**
+ * @brief Wait for the frame in progress to finish.
+ * 
+ */
+void ws2812bFrameWait(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -23648,6 +23648,3154 @@ char_info_t font89_info[] = {
 
 };
 
+/**
+ * @brief 30 pixels height anti-aliased (4 bpp) data array. 
+ * @note Supersampled from the 89 pixels font with:
+ * 		 font_converter.py --c-font fonts.c --source font_89 --scale 3 --bpp 4 --name font_aa_30
+ */
+const uint8_t font_aa_30_data[] = {
+	/* @0 ' ' (1 pixels wide) */
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+	0x00, //  
+
+	/* @30 '!' (4 pixels wide) */
+	0x30, //     
+	0x30, //     
+	0x05, 0x1A, 0x02, // -**.
+	0x0A, 0x1F, 0x05, // *@@-
+	0x0A, 0x1F, 0x05, // *@@-
+	0x0A, 0x1F, 0x05, // *@@-
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x07, 0x1F, 0x00, // =@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x05, 0x1F, 0x00, // -@@ 
+	0x03, 0x0A, 0x08, 0x00, // .*= 
+	0x30, //     
+	0x02, 0x05, 0x03, 0x00, // .-. 
+	0x0A, 0x1F, 0x05, // *@@-
+	0x2F, 0x05, // @@@-
+	0x0A, 0x1F, 0x05, // *@@-
+	0x02, 0x05, 0x03, 0x00, // .-. 
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+
+	/* @106 '"' (8 pixels wide) */
+	0x70, //         
+	0x70, //         
+	0x1F, 0x08, 0x10, 0x08, 0x1F, // @@=  =@@
+	0x1F, 0x05, 0x10, 0x0A, 0x1F, // @@-  *@@
+	0x1F, 0x05, 0x10, 0x0A, 0x1F, // @@-  *@@
+	0x1F, 0x05, 0x10, 0x05, 0x1F, // @@-  -@@
+	0x1F, 0x05, 0x10, 0x05, 0x1F, // @@-  -@@
+	0x1F, 0x05, 0x10, 0x05, 0x0F, 0x0C, // @@-  -@#
+	0x1F, 0x05, 0x10, 0x05, 0x0F, 0x0A, // @@-  -@*
+	0x0C, 0x0F, 0x03, 0x10, 0x05, 0x0F, 0x0A, // #@.  -@*
+	0x03, 0x05, 0x30, 0x05, 0x03, // .-    -.
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+
+	/* @176 '#' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x30, 0x03, 0x05, 0x02, 0x20, 0x02, 0x15, 0x10, //     .-.   .--  
+	0x30, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x10, //     @@-   -@@  
+	0x20, 0x02, 0x1F, 0x03, 0x20, 0x08, 0x0F, 0x0C, 0x10, //    .@@.   =@#  
+	0x20, 0x05, 0x1F, 0x30, 0x0A, 0x0F, 0x0A, 0x10, //    -@@    *@*  
+	0x20, 0x05, 0x1F, 0x30, 0x0A, 0x0F, 0x0A, 0x10, //    -@@    *@*  
+	0x20, 0x08, 0x0F, 0x0A, 0x30, 0x1F, 0x05, 0x10, //    =@*    @@-  
+	0x03, 0xCF, 0x08, // .@@@@@@@@@@@@@=
+	0x03, 0xCF, 0x0A, // .@@@@@@@@@@@@@*
+	0x20, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x20, //    @@-   -@@   
+	0x20, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x20, //    @@-   -@@   
+	0x10, 0x02, 0x1F, 0x02, 0x20, 0x07, 0x0F, 0x0C, 0x20, //   .@@.   =@#   
+	0x10, 0x05, 0x1F, 0x30, 0x0A, 0x0F, 0x0A, 0x20, //   -@@    *@*   
+	0x10, 0x05, 0x1F, 0x30, 0x0A, 0x0F, 0x0A, 0x20, //   -@@    *@*   
+	0x1A, 0x0C, 0x1F, 0x3A, 0x0D, 0x0F, 0x0D, 0x0A, 0x07, 0x00, // **#@@****#@#*= 
+	0xCF, 0x0A, 0x00, // @@@@@@@@@@@@@* 
+	0x15, 0x0C, 0x0F, 0x0C, 0x35, 0x1F, 0x07, 0x05, 0x03, 0x00, // --#@#----@@=-. 
+	0x10, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x30, //   @@-   -@@    
+	0x10, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x30, //   @@-   -@@    
+	0x00, 0x02, 0x1F, 0x03, 0x20, 0x07, 0x0F, 0x0C, 0x30, //  .@@.   =@#    
+	0x00, 0x05, 0x1F, 0x30, 0x0A, 0x0F, 0x0A, 0x30, //  -@@    *@*    
+	0x00, 0x05, 0x0F, 0x0D, 0x30, 0x0A, 0x0F, 0x08, 0x30, //  -@#    *@=    
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @341 '$' (13 pixels wide) */
+	0x50, 0x05, 0x0F, 0x0A, 0x30, //       -@*    
+	0x50, 0x08, 0x0F, 0x0A, 0x30, //       =@*    
+	0x50, 0x0A, 0x0F, 0x07, 0x30, //       *@=    
+	0x40, 0x05, 0x0C, 0x0F, 0x08, 0x30, //      -#@=    
+	0x10, 0x02, 0x0C, 0x5F, 0x0C, 0x03, 0x00, //   .#@@@@@@#. 
+	0x00, 0x05, 0x8F, 0x0D, 0x00, //  -@@@@@@@@@# 
+	0x00, 0x0D, 0x1F, 0x07, 0x02, 0x10, 0x02, 0x07, 0x0D, 0x0F, 0x00, //  #@@=.  .=#@ 
+	0x05, 0x1F, 0x07, 0x60, 0x03, 0x00, // -@@=       . 
+	0x08, 0x1F, 0x05, 0x80, // =@@-         
+	0x07, 0x1F, 0x05, 0x80, // =@@-         
+	0x05, 0x1F, 0x0C, 0x80, // -@@#         
+	0x00, 0x0D, 0x1F, 0x0D, 0x03, 0x60, //  #@@#.       
+	0x00, 0x02, 0x0D, 0x2F, 0x0D, 0x08, 0x02, 0x30, //  .#@@@#=.    
+	0x10, 0x02, 0x08, 0x4F, 0x0C, 0x03, 0x10, //   .=@@@@@#.  
+	0x30, 0x02, 0x07, 0x0D, 0x3F, 0x08, 0x00, //     .=#@@@@= 
+	0x60, 0x03, 0x0C, 0x2F, 0x05, //        .#@@@-
+	0x80, 0x07, 0x1F, 0x0D, //          =@@#
+	0x90, 0x0D, 0x1F, //           #@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0D, 0x1F, //           #@@
+	0x08, 0x03, 0x60, 0x0A, 0x1F, 0x08, // =.       *@@=
+	0x1F, 0x0D, 0x0A, 0x25, 0x07, 0x0C, 0x1F, 0x0D, 0x02, // @@#*---=#@@#.
+	0x0A, 0x8F, 0x0D, 0x02, 0x00, // *@@@@@@@@@#. 
+	0x00, 0x05, 0x0A, 0x0C, 0x2F, 0x0D, 0x0A, 0x05, 0x20, //  -*#@@@#*-   
+	0x30, 0x0D, 0x0F, 0x05, 0x50, //     #@-      
+	0x30, 0x1F, 0x02, 0x50, //     @@.      
+	0x30, 0x1F, 0x60, //     @@       
+	0x30, 0x0A, 0x08, 0x60, //     *=       
+	0xC0, //              
+	0xC0, //              
+
+	/* @496 '%' (21 pixels wide) */
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0x20, 0x15, 0x03, 0x90, 0x08, 0x0A, 0x03, 0x10, //    --.          =*.  
+	0x00, 0x05, 0x0D, 0x2F, 0x0D, 0x02, 0x60, 0x07, 0x0F, 0x0D, 0x20, //  -#@@@#.       =@#   
+	0x02, 0x1F, 0x07, 0x05, 0x0A, 0x0F, 0x0D, 0x50, 0x02, 0x1F, 0x03, 0x20, // .@@=-*@#      .@@.   
+	0x0A, 0x0F, 0x08, 0x20, 0x0D, 0x0F, 0x05, 0x40, 0x0D, 0x0F, 0x08, 0x30, // *@=   #@-     #@=    
+	0x0D, 0x0F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, 0x30, 0x08, 0x0F, 0x0D, 0x40, // #@-   *@*    =@#     
+	0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, 0x20, 0x03, 0x1F, 0x02, 0x40, // @@-   *@*   .@@.     
+	0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, 0x20, 0x0D, 0x0F, 0x07, 0x50, // @@-   *@*   #@=      
+	0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x08, 0x10, 0x08, 0x0F, 0x0C, 0x60, // @@-   *@=  =@#       
+	0x0A, 0x0F, 0x08, 0x20, 0x0D, 0x0F, 0x05, 0x00, 0x05, 0x1F, 0x02, 0x60, // *@=   #@- -@@.       
+	0x03, 0x1F, 0x07, 0x05, 0x0A, 0x0F, 0x0C, 0x00, 0x02, 0x0D, 0x0F, 0x05, 0x70, // .@@=-*@# .#@-        
+	0x00, 0x05, 0x3F, 0x0C, 0x02, 0x00, 0x0A, 0x0F, 0x0A, 0x20, 0x15, 0x03, 0x20, //  -@@@@#. *@*   --.   
+	0x20, 0x15, 0x03, 0x10, 0x05, 0x0F, 0x0D, 0x02, 0x00, 0x05, 0x0D, 0x2F, 0x0D, 0x02, 0x00, //    --.  -@#. -#@@@#. 
+	0x60, 0x02, 0x0D, 0x0F, 0x05, 0x00, 0x02, 0x1F, 0x07, 0x05, 0x0A, 0x0F, 0x0D, 0x00, //        .#@- .@@=-*@# 
+	0x60, 0x0C, 0x0F, 0x0A, 0x10, 0x0A, 0x0F, 0x08, 0x20, 0x0D, 0x0F, 0x05, //        #@*  *@=   #@-
+	0x50, 0x07, 0x0F, 0x0D, 0x20, 0x0D, 0x0F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, //       =@#   #@-   *@*
+	0x40, 0x02, 0x1F, 0x03, 0x20, 0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, //      .@@.   @@-   *@*
+	0x40, 0x0C, 0x0F, 0x08, 0x30, 0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, //      #@=    @@-   *@*
+	0x30, 0x08, 0x0F, 0x0D, 0x40, 0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x08, //     =@#     @@-   *@=
+	0x20, 0x03, 0x1F, 0x02, 0x40, 0x0A, 0x0F, 0x08, 0x20, 0x0D, 0x0F, 0x05, //    .@@.     *@=   #@-
+	0x20, 0x0D, 0x0F, 0x07, 0x50, 0x03, 0x1F, 0x07, 0x05, 0x0A, 0x0F, 0x0C, 0x00, //    #@=      .@@=-*@# 
+	0x10, 0x08, 0x0F, 0x0C, 0x70, 0x05, 0x3F, 0x0C, 0x02, 0x00, //   =@#        -@@@@#. 
+	0x10, 0x1A, 0x02, 0x90, 0x15, 0x03, 0x20, //   **.          --.   
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+
+	/* @766 '&' (19 pixels wide) */
+	0xF0, 0x20, //                    
+	0xF0, 0x20, //                    
+	0x40, 0x05, 0x2A, 0x08, 0x05, 0x70, //      -***=-        
+	0x20, 0x05, 0x0D, 0x5F, 0x0C, 0x02, 0x50, //    -#@@@@@@#.      
+	0x10, 0x03, 0x1F, 0x0D, 0x07, 0x15, 0x0C, 0x1F, 0x0C, 0x50, //   .@@#=--#@@#      
+	0x10, 0x0C, 0x1F, 0x02, 0x30, 0x0C, 0x1F, 0x03, 0x40, //   #@@.    #@@.     
+	0x10, 0x1F, 0x0A, 0x40, 0x05, 0x1F, 0x05, 0x40, //   @@*     -@@-     
+	0x10, 0x1F, 0x0A, 0x40, 0x08, 0x1F, 0x05, 0x40, //   @@*     =@@-     
+	0x10, 0x1F, 0x0D, 0x30, 0x02, 0x0D, 0x0F, 0x0D, 0x50, //   @@#    .#@#      
+	0x10, 0x08, 0x1F, 0x07, 0x10, 0x02, 0x0D, 0x1F, 0x05, 0x50, //   =@@=  .#@@-      
+	0x10, 0x02, 0x1F, 0x0D, 0x02, 0x05, 0x0D, 0x1F, 0x05, 0x60, //   .@@#.-#@@-       
+	0x20, 0x07, 0x1F, 0x0D, 0x1F, 0x0D, 0x03, 0x70, //    =@@#@@#.        
+	0x20, 0x02, 0x0D, 0x2F, 0x08, 0x40, 0x02, 0x15, 0x10, //    .#@@@=     .--  
+	0x10, 0x05, 0x0D, 0x3F, 0x05, 0x40, 0x05, 0x1F, 0x10, //   -#@@@@-     -@@  
+	0x00, 0x05, 0x1F, 0x0D, 0x07, 0x2F, 0x05, 0x30, 0x08, 0x1F, 0x10, //  -@@#=@@@-    =@@  
+	0x02, 0x1F, 0x0D, 0x02, 0x00, 0x05, 0x2F, 0x03, 0x20, 0x0A, 0x0F, 0x0D, 0x10, // .@@#. -@@@.   *@#  
+	0x08, 0x1F, 0x03, 0x20, 0x05, 0x1F, 0x0D, 0x02, 0x10, 0x0D, 0x0F, 0x0A, 0x10, // =@@.   -@@#.  #@*  
+	0x0D, 0x1F, 0x40, 0x05, 0x1F, 0x0D, 0x02, 0x03, 0x1F, 0x05, 0x10, // #@@     -@@#..@@-  
+	0x1F, 0x0C, 0x50, 0x05, 0x2F, 0x0D, 0x0F, 0x0D, 0x20, // @@#      -@@@#@#   
+	0x2F, 0x60, 0x05, 0x3F, 0x05, 0x20, // @@@       -@@@@-   
+	0x0A, 0x1F, 0x07, 0x50, 0x02, 0x0C, 0x2F, 0x0A, 0x20, // *@@=      .#@@@*   
+	0x03, 0x2F, 0x08, 0x03, 0x10, 0x03, 0x07, 0x0D, 0x4F, 0x0D, 0x03, 0x00, // .@@@=.  .=#@@@@@#. 
+	0x00, 0x05, 0x9F, 0x07, 0x02, 0x0C, 0x2F, 0x0A, //  -@@@@@@@@@@=.#@@@*
+	0x10, 0x03, 0x0C, 0x5F, 0x08, 0x02, 0x20, 0x07, 0x1F, 0x0A, //   .#@@@@@@=.   =@@*
+	0x40, 0x25, 0x03, 0x60, 0x02, 0x05, 0x03, //      ---.       .-.
+	0xF0, 0x20, //                    
+	0xF0, 0x20, //                    
+	0xF0, 0x20, //                    
+	0xF0, 0x20, //                    
+	0xF0, 0x20, //                    
+
+	/* @992 '\'' (3 pixels wide) */
+	0x20, //    
+	0x20, //    
+	0x1F, 0x08, // @@=
+	0x1F, 0x07, // @@=
+	0x1F, 0x05, // @@-
+	0x1F, 0x05, // @@-
+	0x1F, 0x05, // @@-
+	0x1F, 0x05, // @@-
+	0x1F, 0x05, // @@-
+	0x0C, 0x0F, 0x05, // #@-
+	0x03, 0x05, 0x00, // .- 
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+
+	/* @1033 '(' (6 pixels wide) */
+	0x50, //       
+	0x20, 0x02, 0x05, 0x03, //    .-.
+	0x20, 0x0C, 0x0F, 0x08, //    #@=
+	0x10, 0x03, 0x1F, 0x02, //   .@@.
+	0x10, 0x0A, 0x0F, 0x0C, 0x00, //   *@# 
+	0x00, 0x02, 0x1F, 0x05, 0x00, //  .@@- 
+	0x00, 0x07, 0x1F, 0x10, //  =@@  
+	0x00, 0x0C, 0x0F, 0x0C, 0x10, //  #@#  
+	0x00, 0x1F, 0x08, 0x10, //  @@=  
+	0x05, 0x1F, 0x05, 0x10, // -@@-  
+	0x08, 0x1F, 0x02, 0x10, // =@@.  
+	0x0A, 0x1F, 0x20, // *@@   
+	0x0C, 0x0F, 0x0D, 0x20, // #@#   
+	0x1F, 0x0A, 0x20, // @@*   
+	0x1F, 0x0A, 0x20, // @@*   
+	0x1F, 0x0A, 0x20, // @@*   
+	0x1F, 0x0A, 0x20, // @@*   
+	0x1F, 0x0A, 0x20, // @@*   
+	0x0D, 0x1F, 0x20, // #@@   
+	0x0A, 0x1F, 0x20, // *@@   
+	0x08, 0x1F, 0x02, 0x10, // =@@.  
+	0x05, 0x1F, 0x05, 0x10, // -@@-  
+	0x02, 0x1F, 0x08, 0x10, // .@@=  
+	0x00, 0x0C, 0x0F, 0x0C, 0x10, //  #@#  
+	0x00, 0x08, 0x1F, 0x02, 0x00, //  =@@. 
+	0x00, 0x02, 0x1F, 0x07, 0x00, //  .@@= 
+	0x10, 0x0C, 0x0F, 0x0C, 0x00, //   #@# 
+	0x10, 0x03, 0x1F, 0x02, //   .@@.
+	0x20, 0x0C, 0x0F, 0x08, //    #@=
+	0x20, 0x02, 0x05, 0x03, //    .-.
+
+	/* @1149 ')' (6 pixels wide) */
+	0x50, //       
+	0x15, 0x30, // --    
+	0x0D, 0x0F, 0x07, 0x20, // #@=   
+	0x07, 0x0F, 0x0D, 0x20, // =@#   
+	0x02, 0x1F, 0x07, 0x10, // .@@=  
+	0x00, 0x0A, 0x0F, 0x0C, 0x10, //  *@#  
+	0x00, 0x05, 0x1F, 0x02, 0x00, //  -@@. 
+	0x00, 0x02, 0x1F, 0x07, 0x00, //  .@@= 
+	0x10, 0x0D, 0x0F, 0x0A, 0x00, //   #@* 
+	0x10, 0x0A, 0x1F, 0x00, //   *@@ 
+	0x10, 0x05, 0x1F, 0x03, //   -@@.
+	0x10, 0x05, 0x1F, 0x05, //   -@@-
+	0x10, 0x03, 0x1F, 0x07, //   .@@=
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x10, 0x03, 0x1F, 0x08, //   .@@=
+	0x10, 0x05, 0x1F, 0x05, //   -@@-
+	0x10, 0x07, 0x1F, 0x03, //   =@@.
+	0x10, 0x0A, 0x1F, 0x00, //   *@@ 
+	0x10, 0x0D, 0x0F, 0x0C, 0x00, //   #@# 
+	0x00, 0x02, 0x1F, 0x07, 0x00, //  .@@= 
+	0x00, 0x05, 0x1F, 0x03, 0x00, //  -@@. 
+	0x00, 0x0A, 0x0F, 0x0C, 0x10, //  *@#  
+	0x02, 0x1F, 0x07, 0x10, // .@@=  
+	0x07, 0x0F, 0x0D, 0x20, // =@#   
+	0x0D, 0x0F, 0x08, 0x20, // #@=   
+	0x15, 0x30, // --    
+
+	/* @1265 '*' (11 pixels wide) */
+	0xA0, //            
+	0xA0, //            
+	0x30, 0x08, 0x0F, 0x0A, 0x30, //     =@*    
+	0x30, 0x07, 0x0F, 0x0A, 0x30, //     =@*    
+	0x03, 0x0D, 0x02, 0x00, 0x05, 0x0F, 0x08, 0x00, 0x02, 0x0A, 0x05, // .#. -@= .*-
+	0x0C, 0x1F, 0x15, 0x0F, 0x15, 0x0D, 0x0F, 0x0D, // #@@--@--#@#
+	0x03, 0x0A, 0x1F, 0x0D, 0x0F, 0x0C, 0x1F, 0x0C, 0x03, // .*@@#@#@@#.
+	0x10, 0x02, 0x08, 0x2F, 0x08, 0x03, 0x10, //   .=@@@=.  
+	0x10, 0x07, 0x0D, 0x2F, 0x0D, 0x08, 0x02, 0x00, //   =#@@@#=. 
+	0x08, 0x1F, 0x0D, 0x0A, 0x0F, 0x08, 0x0D, 0x1F, 0x08, // =@@#*@=#@@=
+	0x08, 0x0F, 0x0C, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x0A, 0x0F, 0x0C, // =@#.-@-.*@#
+	0x02, 0x08, 0x10, 0x05, 0x0F, 0x0A, 0x10, 0x07, 0x02, // .=  -@*  =.
+	0x30, 0x08, 0x0F, 0x0A, 0x30, //     =@*    
+	0x30, 0x05, 0x0A, 0x07, 0x30, //     -*=    
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+
+	/* @1375 '+' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x40, 0x02, 0x1A, 0x50, //      .**      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x03, 0x35, 0x08, 0x1F, 0x45, 0x03, // .----=@@-----.
+	0x0D, 0xBF, 0x0C, // #@@@@@@@@@@@@#
+	0x0C, 0xBF, 0x0A, // #@@@@@@@@@@@@*
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x40, 0x05, 0x1F, 0x50, //      -@@      
+	0x50, 0x15, 0x50, //       --      
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @1452 ',' (5 pixels wide) */
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x10, 0x05, 0x0A, 0x08, //   -*=
+	0x10, 0x2F, //   @@@
+	0x10, 0x2F, //   @@@
+	0x10, 0x1F, 0x0D, //   @@#
+	0x00, 0x03, 0x1F, 0x05, //  .@@-
+	0x00, 0x0C, 0x0F, 0x0A, 0x00, //  #@* 
+	0x03, 0x0F, 0x0D, 0x02, 0x00, // .@#. 
+	0x0C, 0x0F, 0x05, 0x10, // #@-  
+	0x05, 0x03, 0x20, // -.   
+	0x40, //      
+
+	/* @1505 '-' (8 pixels wide) */
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x08, 0x5A, 0x05, // =******-
+	0x6F, 0x0A, // @@@@@@@*
+	0x03, 0x55, 0x02, // .------.
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+
+	/* @1540 '.' (4 pixels wide) */
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x05, 0x0A, 0x08, 0x00, // -*= 
+	0x2F, 0x05, // @@@-
+	0x2F, 0x05, // @@@-
+	0x0A, 0x0F, 0x0D, 0x02, // *@#.
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+
+	/* @1578 '/' (12 pixels wide) */
+	0xB0, //             
+	0x80, 0x05, 0x1F, //          -@@
+	0x80, 0x0C, 0x0F, 0x0C, //          #@#
+	0x70, 0x02, 0x1F, 0x07, //         .@@=
+	0x70, 0x07, 0x1F, 0x02, //         =@@.
+	0x70, 0x0D, 0x0F, 0x0C, 0x00, //         #@# 
+	0x60, 0x03, 0x1F, 0x05, 0x00, //        .@@- 
+	0x60, 0x08, 0x1F, 0x10, //        =@@  
+	0x60, 0x0D, 0x0F, 0x0A, 0x10, //        #@*  
+	0x50, 0x05, 0x1F, 0x03, 0x10, //       -@@.  
+	0x50, 0x0A, 0x0F, 0x0D, 0x20, //       *@#   
+	0x50, 0x1F, 0x08, 0x20, //       @@=   
+	0x40, 0x07, 0x1F, 0x03, 0x20, //      =@@.   
+	0x40, 0x0C, 0x0F, 0x0C, 0x30, //      #@#    
+	0x30, 0x02, 0x1F, 0x07, 0x30, //     .@@=    
+	0x30, 0x08, 0x1F, 0x02, 0x30, //     =@@.    
+	0x30, 0x0D, 0x0F, 0x0C, 0x40, //     #@#     
+	0x20, 0x03, 0x1F, 0x05, 0x40, //    .@@-     
+	0x20, 0x08, 0x1F, 0x50, //    =@@      
+	0x20, 0x1F, 0x08, 0x50, //    @@=      
+	0x10, 0x05, 0x1F, 0x03, 0x50, //   -@@.      
+	0x10, 0x0A, 0x0F, 0x0D, 0x60, //   *@#       
+	0x00, 0x02, 0x1F, 0x08, 0x60, //  .@@=       
+	0x00, 0x07, 0x1F, 0x02, 0x60, //  =@@.       
+	0x00, 0x0C, 0x0F, 0x0C, 0x70, //  #@#        
+	0x02, 0x1F, 0x07, 0x70, // .@@=        
+	0x08, 0x1F, 0x02, 0x70, // =@@.        
+	0x0D, 0x0F, 0x0A, 0x80, // #@*         
+	0x03, 0x05, 0x02, 0x80, // .-.         
+	0xB0, //             
+
+	/* @1707 '0' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x30, 0x03, 0x07, 0x2A, 0x05, 0x02, 0x30, //     .=***-.    
+	0x20, 0x0A, 0x6F, 0x07, 0x20, //    *@@@@@@@=   
+	0x10, 0x0C, 0x2F, 0x1A, 0x0D, 0x2F, 0x07, 0x10, //   #@@@**#@@@=  
+	0x00, 0x08, 0x1F, 0x0D, 0x02, 0x20, 0x05, 0x2F, 0x02, 0x00, //  =@@#.   -@@@. 
+	0x00, 0x2F, 0x02, 0x40, 0x0C, 0x1F, 0x08, 0x00, //  @@@.     #@@= 
+	0x05, 0x1F, 0x0A, 0x50, 0x03, 0x1F, 0x0C, 0x00, // -@@*      .@@# 
+	0x0A, 0x1F, 0x05, 0x60, 0x2F, 0x00, // *@@-       @@@ 
+	0x0A, 0x1F, 0x03, 0x60, 0x0D, 0x1F, 0x02, // *@@.       #@@.
+	0x2F, 0x70, 0x0A, 0x1F, 0x05, // @@@        *@@-
+	0x2F, 0x70, 0x0A, 0x1F, 0x05, // @@@        *@@-
+	0x2F, 0x70, 0x0A, 0x1F, 0x05, // @@@        *@@-
+	0x2F, 0x70, 0x0A, 0x1F, 0x05, // @@@        *@@-
+	0x2F, 0x70, 0x0A, 0x1F, 0x05, // @@@        *@@-
+	0x2F, 0x70, 0x0A, 0x1F, 0x03, // @@@        *@@.
+	0x0A, 0x1F, 0x05, 0x60, 0x2F, 0x00, // *@@-       @@@ 
+	0x0A, 0x1F, 0x05, 0x50, 0x02, 0x1F, 0x0D, 0x00, // *@@-      .@@# 
+	0x05, 0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x08, 0x00, // -@@#      =@@= 
+	0x02, 0x2F, 0x03, 0x30, 0x02, 0x0D, 0x1F, 0x03, 0x00, // .@@@.    .#@@. 
+	0x00, 0x08, 0x1F, 0x0D, 0x05, 0x10, 0x03, 0x0D, 0x1F, 0x0A, 0x10, //  =@@#-  .#@@*  
+	0x10, 0x0D, 0x7F, 0x0C, 0x20, //   #@@@@@@@@#   
+	0x20, 0x08, 0x5F, 0x08, 0x30, //    =@@@@@@=    
+	0x40, 0x03, 0x15, 0x03, 0x50, //      .--.      
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @1861 '1' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x40, 0x03, 0x15, 0x40, //      .--     
+	0x20, 0x02, 0x0A, 0x2F, 0x40, //    .*@@@     
+	0x10, 0x07, 0x4F, 0x40, //   =@@@@@     
+	0x03, 0x0D, 0x1F, 0x08, 0x2F, 0x40, // .#@@=@@@     
+	0x1F, 0x0C, 0x03, 0x00, 0x2F, 0x40, // @@#. @@@     
+	0x0C, 0x07, 0x20, 0x2F, 0x40, // #=   @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x40, 0x2F, 0x40, //      @@@     
+	0x08, 0xAF, 0x03, // =@@@@@@@@@@@.
+	0x08, 0xAF, 0x03, // =@@@@@@@@@@@.
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @1945 '2' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x20, 0x05, 0x2A, 0x08, 0x03, 0x30, //    -***=.    
+	0x00, 0x08, 0x6F, 0x0A, 0x20, //  =@@@@@@@*   
+	0x08, 0x2F, 0x1A, 0x0C, 0x2F, 0x0A, 0x10, // =@@@**#@@@*  
+	0x0A, 0x0D, 0x07, 0x30, 0x05, 0x2F, 0x03, 0x00, // *#=    -@@@. 
+	0x03, 0x02, 0x50, 0x0A, 0x1F, 0x08, 0x00, // ..      *@@= 
+	0x70, 0x05, 0x1F, 0x0A, 0x00, //         -@@* 
+	0x70, 0x05, 0x1F, 0x0A, 0x00, //         -@@* 
+	0x70, 0x07, 0x1F, 0x08, 0x00, //         =@@= 
+	0x70, 0x0C, 0x1F, 0x03, 0x00, //         #@@. 
+	0x60, 0x03, 0x1F, 0x0D, 0x10, //        .@@#  
+	0x60, 0x0C, 0x1F, 0x05, 0x10, //        #@@-  
+	0x50, 0x07, 0x1F, 0x0A, 0x20, //       =@@*   
+	0x40, 0x05, 0x1F, 0x0D, 0x02, 0x20, //      -@@#.   
+	0x30, 0x02, 0x1F, 0x0D, 0x02, 0x30, //     .@@#.    
+	0x20, 0x02, 0x0D, 0x1F, 0x05, 0x40, //    .#@@-     
+	0x10, 0x02, 0x0D, 0x1F, 0x05, 0x50, //   .#@@-      
+	0x00, 0x02, 0x0D, 0x1F, 0x05, 0x60, //  .#@@-       
+	0x00, 0x0D, 0x1F, 0x05, 0x70, //  #@@-        
+	0x0A, 0x1F, 0x0A, 0x75, 0x02, // *@@*--------.
+	0xBF, 0x0A, // @@@@@@@@@@@@*
+	0x0D, 0xAF, 0x08, // #@@@@@@@@@@@=
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @2067 '3' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x20, 0x05, 0x08, 0x1A, 0x08, 0x05, 0x30, //    -=**=-    
+	0x00, 0x05, 0x0D, 0x5F, 0x0D, 0x02, 0x10, //  -#@@@@@@#.  
+	0x03, 0x2F, 0x0C, 0x0A, 0x0C, 0x2F, 0x0D, 0x10, // .@@@#*#@@@#  
+	0x05, 0x0F, 0x08, 0x02, 0x20, 0x05, 0x2F, 0x05, 0x00, // -@=.   -@@@- 
+	0x12, 0x50, 0x08, 0x1F, 0x0A, 0x00, // ..      =@@* 
+	0x70, 0x05, 0x1F, 0x0A, 0x00, //         -@@* 
+	0x70, 0x05, 0x1F, 0x0A, 0x00, //         -@@* 
+	0x70, 0x0C, 0x1F, 0x05, 0x00, //         #@@- 
+	0x60, 0x05, 0x1F, 0x0C, 0x10, //        -@@#  
+	0x10, 0x03, 0x15, 0x07, 0x0C, 0x1F, 0x0C, 0x02, 0x10, //   .--=#@@#.  
+	0x10, 0x5F, 0x0A, 0x03, 0x20, //   @@@@@@*.   
+	0x10, 0x08, 0x2A, 0x0D, 0x2F, 0x0A, 0x10, //   =***#@@@*  
+	0x60, 0x03, 0x0C, 0x1F, 0x0A, 0x00, //        .#@@* 
+	0x80, 0x0D, 0x1F, 0x05, //          #@@-
+	0x80, 0x07, 0x1F, 0x0A, //          =@@*
+	0x80, 0x05, 0x1F, 0x0A, //          -@@*
+	0x80, 0x07, 0x1F, 0x08, //          =@@=
+	0x08, 0x02, 0x50, 0x02, 0x0D, 0x1F, 0x03, // =.      .#@@.
+	0x1F, 0x0A, 0x05, 0x20, 0x05, 0x0D, 0x1F, 0x0C, 0x00, // @@*-   -#@@# 
+	0x0D, 0x8F, 0x0D, 0x02, 0x00, // #@@@@@@@@@#. 
+	0x02, 0x08, 0x0D, 0x4F, 0x0D, 0x08, 0x20, // .=#@@@@@#=   
+	0x20, 0x02, 0x25, 0x03, 0x40, //    .---.     
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @2208 '4' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x60, 0x02, 0x25, 0x02, 0x20, //        .---.   
+	0x60, 0x0D, 0x2F, 0x0A, 0x20, //        #@@@*   
+	0x50, 0x07, 0x3F, 0x0A, 0x20, //       =@@@@*   
+	0x40, 0x02, 0x1F, 0x0C, 0x1F, 0x0A, 0x20, //      .@@#@@*   
+	0x40, 0x08, 0x0F, 0x0C, 0x05, 0x1F, 0x0A, 0x20, //      =@#-@@*   
+	0x30, 0x03, 0x1F, 0x03, 0x05, 0x1F, 0x0A, 0x20, //     .@@.-@@*   
+	0x30, 0x0C, 0x0F, 0x0A, 0x00, 0x05, 0x1F, 0x0A, 0x20, //     #@* -@@*   
+	0x20, 0x05, 0x1F, 0x02, 0x00, 0x05, 0x1F, 0x0A, 0x20, //    -@@. -@@*   
+	0x20, 0x0D, 0x0F, 0x08, 0x10, 0x05, 0x1F, 0x0A, 0x20, //    #@=  -@@*   
+	0x10, 0x07, 0x0F, 0x0D, 0x02, 0x10, 0x05, 0x1F, 0x0A, 0x20, //   =@#.  -@@*   
+	0x00, 0x02, 0x1F, 0x07, 0x20, 0x05, 0x1F, 0x0A, 0x20, //  .@@=   -@@*   
+	0x00, 0x08, 0x0F, 0x0D, 0x30, 0x05, 0x1F, 0x0A, 0x20, //  =@#    -@@*   
+	0x03, 0x1F, 0x03, 0x30, 0x05, 0x1F, 0x0A, 0x20, // .@@.    -@@*   
+	0x0C, 0x0F, 0x0C, 0x40, 0x05, 0x1F, 0x0A, 0x20, // #@#     -@@*   
+	0xDF, 0x07, // @@@@@@@@@@@@@@=
+	0xDF, 0x08, // @@@@@@@@@@@@@@=
+	0x03, 0x65, 0x08, 0x1F, 0x0C, 0x15, 0x02, // .-------=@@#--.
+	0x70, 0x05, 0x1F, 0x0A, 0x20, //         -@@*   
+	0x70, 0x05, 0x1F, 0x0A, 0x20, //         -@@*   
+	0x70, 0x05, 0x1F, 0x0A, 0x20, //         -@@*   
+	0x70, 0x03, 0x1F, 0x08, 0x20, //         .@@=   
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @2357 '5' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x00, 0x03, 0x85, 0x10, //  .---------  
+	0x00, 0x9F, 0x05, 0x00, //  @@@@@@@@@@- 
+	0x00, 0x9F, 0x03, 0x00, //  @@@@@@@@@@. 
+	0x00, 0x2F, 0x80, //  @@@         
+	0x00, 0x2F, 0x80, //  @@@         
+	0x00, 0x2F, 0x80, //  @@@         
+	0x00, 0x2F, 0x80, //  @@@         
+	0x00, 0x2F, 0x80, //  @@@         
+	0x00, 0x2F, 0x35, 0x40, //  @@@----     
+	0x00, 0x7F, 0x0C, 0x03, 0x10, //  @@@@@@@@#.  
+	0x00, 0x1C, 0x2A, 0x0C, 0x3F, 0x05, 0x00, //  ##***#@@@@- 
+	0x60, 0x02, 0x0A, 0x1F, 0x0D, 0x00, //        .*@@# 
+	0x80, 0x0C, 0x1F, 0x05, //          #@@-
+	0x80, 0x07, 0x1F, 0x0A, //          =@@*
+	0x80, 0x05, 0x1F, 0x0A, //          -@@*
+	0x80, 0x05, 0x1F, 0x0A, //          -@@*
+	0x80, 0x0A, 0x1F, 0x07, //          *@@=
+	0x05, 0x60, 0x05, 0x2F, 0x02, // -       -@@@.
+	0x0F, 0x0C, 0x07, 0x02, 0x10, 0x02, 0x07, 0x2F, 0x08, 0x00, // @#=.  .=@@@= 
+	0x9F, 0x0A, 0x10, // @@@@@@@@@@*  
+	0x03, 0x0A, 0x5F, 0x0C, 0x03, 0x20, // .*@@@@@@#.   
+	0x20, 0x03, 0x25, 0x50, //    .---      
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @2462 '6' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x40, 0x03, 0x07, 0x2A, 0x07, 0x03, 0x10, //      .=***=.  
+	0x20, 0x03, 0x0C, 0x6F, 0x03, 0x00, //    .#@@@@@@@. 
+	0x10, 0x05, 0x2F, 0x0C, 0x25, 0x0A, 0x0D, 0x05, 0x00, //   -@@@#---*#- 
+	0x00, 0x02, 0x0D, 0x1F, 0x05, 0x70, //  .#@@-        
+	0x00, 0x08, 0x1F, 0x07, 0x80, //  =@@=         
+	0x02, 0x1F, 0x0D, 0x90, // .@@#          
+	0x05, 0x1F, 0x07, 0x90, // -@@=          
+	0x0A, 0x1F, 0x05, 0x90, // *@@-          
+	0x0C, 0x1F, 0x20, 0x25, 0x02, 0x30, // #@@   ---.    
+	0x2F, 0x03, 0x0C, 0x4F, 0x0C, 0x03, 0x10, // @@@.#@@@@@#.  
+	0x4F, 0x0D, 0x1A, 0x0D, 0x2F, 0x03, 0x00, // @@@@@#**#@@@. 
+	0x2F, 0x0A, 0x02, 0x30, 0x0A, 0x1F, 0x0C, 0x00, // @@@*.    *@@# 
+	0x2F, 0x60, 0x2F, 0x02, // @@@       @@@.
+	0x2F, 0x60, 0x0A, 0x1F, 0x05, // @@@       *@@-
+	0x0D, 0x1F, 0x60, 0x0A, 0x1F, 0x05, // #@@       *@@-
+	0x0A, 0x1F, 0x05, 0x50, 0x0A, 0x1F, 0x05, // *@@-      *@@-
+	0x08, 0x1F, 0x08, 0x50, 0x2F, 0x02, // =@@=      @@@.
+	0x03, 0x1F, 0x0D, 0x40, 0x07, 0x1F, 0x0C, 0x00, // .@@#     =@@# 
+	0x00, 0x0C, 0x1F, 0x0A, 0x03, 0x00, 0x02, 0x07, 0x2F, 0x03, 0x00, //  #@@*. .=@@@. 
+	0x00, 0x02, 0x0D, 0x7F, 0x05, 0x10, //  .#@@@@@@@@-  
+	0x10, 0x02, 0x0C, 0x4F, 0x0C, 0x03, 0x20, //   .#@@@@@#.   
+	0x30, 0x02, 0x25, 0x02, 0x40, //     .---.     
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @2608 '7' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x03, 0xB5, 0x00, // .------------ 
+	0xCF, 0x05, // @@@@@@@@@@@@@-
+	0x0D, 0xBF, 0x05, // #@@@@@@@@@@@@-
+	0x90, 0x0C, 0x1F, 0x00, //           #@@ 
+	0x80, 0x03, 0x1F, 0x08, 0x00, //          .@@= 
+	0x80, 0x0C, 0x1F, 0x02, 0x00, //          #@@. 
+	0x70, 0x02, 0x1F, 0x0A, 0x10, //         .@@*  
+	0x70, 0x08, 0x1F, 0x03, 0x10, //         =@@.  
+	0x60, 0x02, 0x1F, 0x0C, 0x20, //        .@@#   
+	0x60, 0x08, 0x1F, 0x07, 0x20, //        =@@=   
+	0x60, 0x0D, 0x0F, 0x0D, 0x30, //        #@#    
+	0x50, 0x07, 0x1F, 0x07, 0x30, //       =@@=    
+	0x50, 0x0D, 0x1F, 0x02, 0x30, //       #@@.    
+	0x40, 0x03, 0x1F, 0x08, 0x40, //      .@@=     
+	0x40, 0x0C, 0x1F, 0x03, 0x40, //      #@@.     
+	0x30, 0x03, 0x1F, 0x0C, 0x50, //     .@@#      
+	0x30, 0x0A, 0x1F, 0x03, 0x50, //     *@@.      
+	0x20, 0x02, 0x1F, 0x0D, 0x60, //    .@@#       
+	0x20, 0x08, 0x1F, 0x07, 0x60, //    =@@=       
+	0x20, 0x2F, 0x70, //    @@@        
+	0x10, 0x05, 0x1F, 0x08, 0x70, //   -@@=        
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @2712 '8' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x30, 0x05, 0x3A, 0x05, 0x30, //     -****-    
+	0x10, 0x05, 0x0D, 0x5F, 0x0D, 0x05, 0x10, //   -#@@@@@@#-  
+	0x00, 0x05, 0x2F, 0x08, 0x15, 0x08, 0x2F, 0x03, 0x00, //  -@@@=--=@@@. 
+	0x00, 0x0D, 0x1F, 0x03, 0x30, 0x03, 0x1F, 0x0C, 0x00, //  #@@.    .@@# 
+	0x05, 0x1F, 0x0C, 0x50, 0x0C, 0x1F, 0x00, // -@@#      #@@ 
+	0x05, 0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x00, // -@@*      *@@ 
+	0x03, 0x1F, 0x0D, 0x50, 0x0D, 0x0F, 0x0C, 0x00, // .@@#      #@# 
+	0x00, 0x0D, 0x1F, 0x0A, 0x30, 0x07, 0x1F, 0x05, 0x00, //  #@@*    =@@- 
+	0x00, 0x03, 0x2F, 0x0A, 0x02, 0x00, 0x08, 0x1F, 0x0A, 0x10, //  .@@@*. =@@*  
+	0x10, 0x05, 0x0D, 0x2F, 0x0D, 0x1F, 0x07, 0x20, //   -#@@@#@@=   
+	0x20, 0x02, 0x0C, 0x3F, 0x08, 0x30, //    .#@@@@=    
+	0x10, 0x02, 0x0C, 0x1F, 0x0C, 0x2F, 0x0D, 0x03, 0x10, //   .#@@#@@@#.  
+	0x00, 0x05, 0x1F, 0x0D, 0x05, 0x00, 0x02, 0x0C, 0x2F, 0x05, 0x00, //  -@@#- .#@@@- 
+	0x02, 0x1F, 0x0D, 0x02, 0x30, 0x0A, 0x1F, 0x0D, 0x02, // .@@#.    *@@#.
+	0x0A, 0x1F, 0x07, 0x50, 0x0C, 0x1F, 0x07, // *@@=      #@@=
+	0x2F, 0x60, 0x05, 0x1F, 0x0A, // @@@       -@@*
+	0x2F, 0x60, 0x05, 0x1F, 0x0A, // @@@       -@@*
+	0x0D, 0x1F, 0x03, 0x50, 0x08, 0x1F, 0x07, // #@@.      =@@=
+	0x08, 0x1F, 0x0D, 0x02, 0x30, 0x05, 0x1F, 0x0D, 0x02, // =@@#.    -@@#.
+	0x00, 0x0A, 0x2F, 0x0C, 0x1A, 0x0D, 0x2F, 0x05, 0x00, //  *@@@#**#@@@- 
+	0x10, 0x07, 0x0D, 0x5F, 0x0A, 0x02, 0x10, //   =#@@@@@@*.  
+	0x30, 0x02, 0x25, 0x03, 0x40, //     .---.     
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @2888 '9' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x20, 0x02, 0x05, 0x2A, 0x07, 0x03, 0x30, //    .-***=.    
+	0x10, 0x07, 0x6F, 0x08, 0x20, //   =@@@@@@@=   
+	0x00, 0x08, 0x1F, 0x0D, 0x07, 0x05, 0x07, 0x0D, 0x1F, 0x08, 0x10, //  =@@#=-=#@@=  
+	0x03, 0x1F, 0x0D, 0x02, 0x20, 0x02, 0x0D, 0x1F, 0x03, 0x00, // .@@#.   .#@@. 
+	0x0A, 0x1F, 0x07, 0x40, 0x07, 0x1F, 0x08, 0x00, // *@@=     =@@= 
+	0x0D, 0x1F, 0x02, 0x50, 0x1F, 0x0D, 0x00, // #@@.      @@# 
+	0x2F, 0x60, 0x0D, 0x1F, 0x00, // @@@       #@@ 
+	0x2F, 0x60, 0x0A, 0x1F, 0x05, // @@@       *@@-
+	0x2F, 0x03, 0x50, 0x0A, 0x1F, 0x05, // @@@.      *@@-
+	0x0A, 0x1F, 0x08, 0x50, 0x0C, 0x1F, 0x05, // *@@=      #@@-
+	0x03, 0x2F, 0x07, 0x02, 0x10, 0x05, 0x0C, 0x2F, 0x05, // .@@@=.  -#@@@-
+	0x00, 0x07, 0xAF, 0x05, //  =@@@@@@@@@@@-
+	0x10, 0x03, 0x0A, 0x2F, 0x0D, 0x08, 0x03, 0x0A, 0x1F, 0x03, //   .*@@@#=.*@@.
+	0x90, 0x0A, 0x1F, 0x00, //           *@@ 
+	0x90, 0x1F, 0x0D, 0x00, //           @@# 
+	0x80, 0x05, 0x1F, 0x08, 0x00, //          -@@= 
+	0x80, 0x0C, 0x1F, 0x03, 0x00, //          #@@. 
+	0x70, 0x0A, 0x1F, 0x0C, 0x10, //         *@@#  
+	0x03, 0x0A, 0x05, 0x20, 0x03, 0x0C, 0x1F, 0x0D, 0x02, 0x10, // .*-   .#@@#.  
+	0x05, 0x7F, 0x0D, 0x03, 0x20, // -@@@@@@@@#.   
+	0x02, 0x0C, 0x5F, 0x08, 0x02, 0x30, // .#@@@@@@=.    
+	0x20, 0x25, 0x03, 0x60, //    ---.       
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @3038 ':' (4 pixels wide) */
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x0A, 0x0F, 0x0D, 0x02, // *@#.
+	0x2F, 0x05, // @@@-
+	0x2F, 0x05, // @@@-
+	0x05, 0x0A, 0x08, 0x00, // -*= 
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x05, 0x0A, 0x08, 0x00, // -*= 
+	0x2F, 0x05, // @@@-
+	0x2F, 0x05, // @@@-
+	0x0A, 0x0F, 0x0D, 0x02, // *@#.
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+
+	/* @3084 ';' (5 pixels wide) */
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x10, 0x03, 0x05, 0x02, //   .-.
+	0x00, 0x03, 0x1F, 0x0D, //  .@@#
+	0x00, 0x05, 0x2F, //  -@@@
+	0x00, 0x03, 0x1F, 0x0D, //  .@@#
+	0x10, 0x03, 0x05, 0x02, //   .-.
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x10, 0x08, 0x0A, 0x08, //   =*=
+	0x10, 0x2F, //   @@@
+	0x10, 0x2F, //   @@@
+	0x10, 0x1F, 0x0A, //   @@*
+	0x00, 0x07, 0x1F, 0x03, //  =@@.
+	0x00, 0x0D, 0x0F, 0x08, 0x00, //  #@= 
+	0x07, 0x0F, 0x0D, 0x10, // =@#  
+	0x0D, 0x0F, 0x03, 0x10, // #@.  
+	0x05, 0x03, 0x20, // -.   
+	0x40, //      
+
+	/* @3150 '<' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xA0, 0x02, 0x08, 0x03, //            .=.
+	0x80, 0x02, 0x08, 0x1F, 0x05, //          .=@@-
+	0x60, 0x02, 0x08, 0x3F, 0x03, //        .=@@@@.
+	0x50, 0x07, 0x0D, 0x2F, 0x08, 0x02, 0x00, //       =#@@@=. 
+	0x30, 0x07, 0x0D, 0x2F, 0x08, 0x02, 0x20, //     =#@@@=.   
+	0x10, 0x07, 0x0D, 0x2F, 0x08, 0x02, 0x40, //   =#@@@=.     
+	0x05, 0x0D, 0x2F, 0x08, 0x02, 0x60, // -#@@@=.       
+	0x1F, 0x0D, 0x08, 0x02, 0x80, // @@#=.         
+	0x0D, 0x1F, 0x0C, 0x03, 0x80, // #@@#.         
+	0x02, 0x08, 0x2F, 0x0C, 0x05, 0x60, // .=@@@#-       
+	0x10, 0x02, 0x08, 0x2F, 0x0D, 0x07, 0x40, //   .=@@@#=     
+	0x30, 0x02, 0x08, 0x2F, 0x0D, 0x07, 0x20, //     .=@@@#=   
+	0x50, 0x02, 0x08, 0x2F, 0x0D, 0x07, 0x00, //       .=@@@#= 
+	0x70, 0x03, 0x0C, 0x2F, 0x05, //         .#@@@-
+	0x90, 0x03, 0x0C, 0x0F, 0x05, //           .#@-
+	0xB0, 0x03, 0x02, //             ..
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @3255 '=' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x03, 0xA5, 0x03, // .-----------.
+	0xCF, // @@@@@@@@@@@@@
+	0x0D, 0xAF, 0x0D, // #@@@@@@@@@@@#
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x0D, 0xAF, 0x0D, // #@@@@@@@@@@@#
+	0xCF, // @@@@@@@@@@@@@
+	0x03, 0xA5, 0x03, // .-----------.
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @3293 '>' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x05, 0xC0, // -             
+	0x0F, 0x0D, 0x07, 0xA0, // @#=           
+	0x2F, 0x0D, 0x07, 0x80, // @@@#=         
+	0x03, 0x0C, 0x2F, 0x0D, 0x07, 0x60, // .#@@@#=       
+	0x10, 0x03, 0x0C, 0x2F, 0x0D, 0x07, 0x40, //   .#@@@#=     
+	0x30, 0x03, 0x08, 0x2F, 0x0D, 0x07, 0x20, //     .=@@@#=   
+	0x50, 0x02, 0x08, 0x2F, 0x0D, 0x07, 0x00, //       .=@@@#= 
+	0x80, 0x07, 0x0D, 0x1F, 0x03, //          =#@@.
+	0x70, 0x02, 0x08, 0x2F, 0x03, //         .=@@@.
+	0x50, 0x03, 0x08, 0x2F, 0x0D, 0x07, 0x00, //       .=@@@#= 
+	0x30, 0x03, 0x0C, 0x2F, 0x0D, 0x07, 0x20, //     .#@@@#=   
+	0x10, 0x03, 0x0C, 0x2F, 0x0D, 0x07, 0x40, //   .#@@@#=     
+	0x05, 0x0C, 0x2F, 0x0D, 0x07, 0x60, // -#@@@#=       
+	0x2F, 0x0D, 0x07, 0x80, // @@@#=         
+	0x0F, 0x0D, 0x07, 0xA0, // @#=           
+	0x05, 0xC0, // -             
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @3391 '?' (12 pixels wide) */
+	0xB0, //             
+	0xB0, //             
+	0x10, 0x05, 0x08, 0x1A, 0x08, 0x05, 0x30, //   -=**=-    
+	0x08, 0x6F, 0x0D, 0x03, 0x10, // =@@@@@@@#.  
+	0x1F, 0x0A, 0x25, 0x0C, 0x2F, 0x02, 0x00, // @@*---#@@@. 
+	0x0A, 0x02, 0x40, 0x05, 0x1F, 0x0C, 0x00, // *.     -@@# 
+	0x70, 0x0C, 0x1F, 0x02, //         #@@.
+	0x70, 0x05, 0x1F, 0x05, //         -@@-
+	0x70, 0x05, 0x1F, 0x05, //         -@@-
+	0x70, 0x05, 0x1F, 0x05, //         -@@-
+	0x70, 0x0A, 0x1F, 0x00, //         *@@ 
+	0x60, 0x05, 0x1F, 0x08, 0x00, //        -@@= 
+	0x20, 0x02, 0x15, 0x0A, 0x1F, 0x0D, 0x02, 0x00, //    .--*@@#. 
+	0x20, 0x0A, 0x3F, 0x08, 0x02, 0x10, //    *@@@@=.  
+	0x20, 0x0A, 0x1F, 0x05, 0x40, //    *@@-     
+	0x20, 0x0A, 0x1F, 0x50, //    *@@      
+	0x20, 0x0A, 0x1F, 0x50, //    *@@      
+	0x20, 0x0A, 0x1F, 0x50, //    *@@      
+	0x20, 0x05, 0x0A, 0x08, 0x50, //    -*=      
+	0xB0, //             
+	0x20, 0x02, 0x05, 0x03, 0x50, //    .-.      
+	0x20, 0x0D, 0x1F, 0x03, 0x40, //    #@@.     
+	0x20, 0x2F, 0x05, 0x40, //    @@@-     
+	0x20, 0x0D, 0x1F, 0x03, 0x40, //    #@@.     
+	0x20, 0x02, 0x05, 0x03, 0x50, //    .-.      
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+
+	/* @3510 '@' (24 pixels wide) */
+	0xF0, 0x70, //                         
+	0xF0, 0x70, //                         
+	0xF0, 0x70, //                         
+	0x70, 0x03, 0x08, 0x0A, 0x4F, 0x0A, 0x07, 0x02, 0x40, //         .=*@@@@@*=.     
+	0x50, 0x07, 0x0D, 0xAF, 0x08, 0x02, 0x20, //       =#@@@@@@@@@@@=.   
+	0x30, 0x02, 0x0C, 0x1F, 0x0D, 0x08, 0x05, 0x30, 0x03, 0x07, 0x0C, 0x1F, 0x0D, 0x02, 0x10, //     .#@@#=-    .=#@@#.  
+	0x20, 0x02, 0x0D, 0x0F, 0x0D, 0x07, 0x90, 0x07, 0x1F, 0x0D, 0x10, //    .#@#=          =@@#  
+	0x20, 0x0D, 0x0F, 0x0D, 0x02, 0xB0, 0x05, 0x1F, 0x07, 0x00, //    #@#.            -@@= 
+	0x10, 0x08, 0x1F, 0x02, 0x30, 0x15, 0x02, 0x60, 0x0C, 0x0F, 0x0D, 0x00, //   =@@.    --.       #@# 
+	0x00, 0x02, 0x1F, 0x07, 0x20, 0x05, 0x0D, 0x2F, 0x08, 0x02, 0x1F, 0x03, 0x10, 0x05, 0x1F, 0x02, //  .@@=   -#@@@=.@@.  -@@.
+	0x00, 0x08, 0x0F, 0x0D, 0x20, 0x05, 0x1F, 0x0D, 0x0A, 0x0D, 0x0F, 0x0D, 0x1F, 0x20, 0x03, 0x1F, 0x05, //  =@#   -@@#*#@#@@   .@@-
+	0x00, 0x1F, 0x07, 0x10, 0x02, 0x1F, 0x0A, 0x10, 0x02, 0x0D, 0x1F, 0x0C, 0x30, 0x1F, 0x05, //  @@=  .@@*  .#@@#    @@-
+	0x05, 0x1F, 0x02, 0x10, 0x08, 0x1F, 0x02, 0x20, 0x03, 0x1F, 0x0A, 0x30, 0x1F, 0x05, // -@@.  =@@.   .@@*    @@-
+	0x08, 0x0F, 0x0D, 0x20, 0x0D, 0x0F, 0x0A, 0x30, 0x02, 0x1F, 0x07, 0x20, 0x02, 0x1F, 0x05, // =@#   #@*    .@@=   .@@-
+	0x0A, 0x0F, 0x0A, 0x20, 0x1F, 0x05, 0x30, 0x05, 0x1F, 0x05, 0x20, 0x05, 0x1F, 0x02, // *@*   @@-    -@@-   -@@.
+	0x0D, 0x0F, 0x08, 0x10, 0x05, 0x1F, 0x03, 0x30, 0x07, 0x1F, 0x30, 0x07, 0x1F, 0x00, // #@=  -@@.    =@@    =@@ 
+	0x1F, 0x05, 0x10, 0x05, 0x1F, 0x40, 0x0A, 0x0F, 0x0D, 0x30, 0x0C, 0x0F, 0x0A, 0x00, // @@-  -@@     *@#    #@* 
+	0x1F, 0x05, 0x10, 0x05, 0x1F, 0x02, 0x20, 0x05, 0x1F, 0x0A, 0x20, 0x02, 0x1F, 0x03, 0x00, // @@-  -@@.   -@@*   .@@. 
+	0x1F, 0x05, 0x10, 0x03, 0x1F, 0x07, 0x10, 0x05, 0x2F, 0x0D, 0x10, 0x02, 0x0C, 0x0F, 0x0C, 0x10, // @@-  .@@=  -@@@#  .#@#  
+	0x1F, 0x08, 0x20, 0x0D, 0x1F, 0x0A, 0x0C, 0x0F, 0x0D, 0x07, 0x1F, 0x0D, 0x0A, 0x0D, 0x0F, 0x0D, 0x02, 0x10, // @@=   #@@*#@#=@@#*#@#.  
+	0x0A, 0x0F, 0x0A, 0x20, 0x05, 0x0D, 0x2F, 0x0C, 0x02, 0x00, 0x05, 0x3F, 0x0C, 0x02, 0x20, // *@*   -#@@@#. -@@@@#.   
+	0x08, 0x1F, 0x40, 0x15, 0x02, 0x30, 0x02, 0x15, 0x02, 0x40, // =@@     --.    .--.     
+	0x03, 0x1F, 0x07, 0xF0, 0x30, // .@@=                    
+	0x00, 0x0C, 0x1F, 0x05, 0xF0, 0x20, //  #@@-                   
+	0x00, 0x02, 0x0D, 0x1F, 0x08, 0x02, 0xF0, 0x00, //  .#@@=.                 
+	0x10, 0x02, 0x0D, 0x2F, 0x0A, 0x08, 0x35, 0x07, 0x0A, 0x0D, 0x0A, 0x60, //   .#@@@*=----=*#*       
+	0x30, 0x07, 0x0D, 0x9F, 0x08, 0x60, //     =#@@@@@@@@@@=       
+	0x50, 0x03, 0x05, 0x4A, 0x08, 0x05, 0x03, 0x70, //       .-*****=-.        
+	0xF0, 0x70, //                         
+	0xF0, 0x70, //                         
+
+	/* @3822 'A' (18 pixels wide) */
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0x60, 0x25, 0x70, //        ---        
+	0x50, 0x05, 0x2F, 0x07, 0x60, //       -@@@=       
+	0x50, 0x0A, 0x2F, 0x0D, 0x60, //       *@@@#       
+	0x50, 0x1F, 0x0C, 0x1F, 0x03, 0x50, //       @@#@@.      
+	0x40, 0x07, 0x1F, 0x02, 0x1F, 0x08, 0x50, //      =@@.@@=      
+	0x40, 0x0C, 0x0F, 0x0A, 0x00, 0x0C, 0x0F, 0x0D, 0x50, //      #@* #@#      
+	0x30, 0x02, 0x1F, 0x05, 0x00, 0x07, 0x1F, 0x05, 0x40, //     .@@- =@@-     
+	0x30, 0x07, 0x1F, 0x10, 0x02, 0x1F, 0x0A, 0x40, //     =@@  .@@*     
+	0x30, 0x0D, 0x0F, 0x0A, 0x20, 0x0C, 0x1F, 0x40, //     #@*   #@@     
+	0x20, 0x03, 0x1F, 0x05, 0x20, 0x07, 0x1F, 0x05, 0x30, //    .@@-   =@@-    
+	0x20, 0x08, 0x1F, 0x30, 0x02, 0x1F, 0x0C, 0x30, //    =@@    .@@#    
+	0x20, 0x0D, 0x0F, 0x0A, 0x40, 0x0C, 0x1F, 0x02, 0x20, //    #@*     #@@.   
+	0x10, 0x03, 0x1F, 0x05, 0x40, 0x07, 0x1F, 0x07, 0x20, //   .@@-     =@@=   
+	0x10, 0x0A, 0x1F, 0x55, 0x07, 0x1F, 0x0C, 0x20, //   *@@------=@@#   
+	0x10, 0xCF, 0x03, 0x10, //   @@@@@@@@@@@@@.  
+	0x00, 0x05, 0x1F, 0x0C, 0x6A, 0x0C, 0x1F, 0x08, 0x10, //  -@@#*******#@@=  
+	0x00, 0x0C, 0x1F, 0x80, 0x1F, 0x0D, 0x10, //  #@@         @@#  
+	0x02, 0x1F, 0x0A, 0x80, 0x0A, 0x1F, 0x03, 0x00, // .@@*         *@@. 
+	0x07, 0x1F, 0x05, 0x80, 0x05, 0x1F, 0x0A, 0x00, // =@@-         -@@* 
+	0x0C, 0x1F, 0xA0, 0x0D, 0x1F, 0x00, // #@@           #@@ 
+	0x1F, 0x08, 0xA0, 0x08, 0x1F, 0x05, // @@=           =@@-
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+
+	/* @3991 'B' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x03, 0x55, 0x03, 0x50, // .------.      
+	0x8F, 0x08, 0x02, 0x20, // @@@@@@@@@=.   
+	0x9F, 0x0D, 0x20, // @@@@@@@@@@#   
+	0x2F, 0x30, 0x07, 0x0D, 0x1F, 0x08, 0x10, // @@@    =#@@=  
+	0x2F, 0x40, 0x07, 0x1F, 0x0D, 0x10, // @@@     =@@#  
+	0x2F, 0x50, 0x2F, 0x10, // @@@      @@@  
+	0x2F, 0x50, 0x2F, 0x10, // @@@      @@@  
+	0x2F, 0x40, 0x02, 0x1F, 0x0C, 0x10, // @@@     .@@#  
+	0x2F, 0x40, 0x0A, 0x1F, 0x05, 0x10, // @@@     *@@-  
+	0x2F, 0x35, 0x0C, 0x1F, 0x08, 0x20, // @@@----#@@=   
+	0x8F, 0x0D, 0x05, 0x20, // @@@@@@@@@#-   
+	0x2F, 0x3A, 0x0C, 0x2F, 0x0A, 0x10, // @@@****#@@@*  
+	0x2F, 0x40, 0x02, 0x0C, 0x1F, 0x08, 0x00, // @@@     .#@@= 
+	0x2F, 0x50, 0x02, 0x2F, 0x00, // @@@      .@@@ 
+	0x2F, 0x60, 0x0A, 0x1F, 0x05, // @@@       *@@-
+	0x2F, 0x60, 0x0A, 0x1F, 0x05, // @@@       *@@-
+	0x2F, 0x60, 0x0D, 0x1F, 0x03, // @@@       #@@.
+	0x2F, 0x50, 0x05, 0x1F, 0x0D, 0x00, // @@@      -@@# 
+	0x2F, 0x45, 0x0C, 0x2F, 0x05, 0x00, // @@@-----#@@@- 
+	0xAF, 0x05, 0x10, // @@@@@@@@@@@-  
+	0x0D, 0x6F, 0x0C, 0x08, 0x02, 0x20, // #@@@@@@@#=.   
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @4108 'C' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x40, 0x02, 0x05, 0x2A, 0x07, 0x03, 0x20, //      .-***=.   
+	0x30, 0x08, 0x6F, 0x0C, 0x03, 0x00, //     =@@@@@@@#. 
+	0x10, 0x02, 0x0D, 0x2F, 0x0C, 0x1A, 0x0D, 0x2F, 0x03, //   .#@@@#**#@@@.
+	0x10, 0x0C, 0x1F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x05, //   #@@#.    .#@-
+	0x00, 0x07, 0x1F, 0x0D, 0x70, 0x08, 0x02, //  =@@#        =.
+	0x00, 0x0D, 0x1F, 0x03, 0x90, //  #@@.          
+	0x05, 0x1F, 0x0C, 0xA0, // -@@#           
+	0x0A, 0x1F, 0x05, 0xA0, // *@@-           
+	0x0C, 0x1F, 0x03, 0xA0, // #@@.           
+	0x2F, 0xB0, // @@@            
+	0x2F, 0xB0, // @@@            
+	0x2F, 0xB0, // @@@            
+	0x2F, 0xB0, // @@@            
+	0x0D, 0x1F, 0x03, 0xA0, // #@@.           
+	0x0A, 0x1F, 0x07, 0xA0, // *@@=           
+	0x07, 0x1F, 0x0C, 0xA0, // =@@#           
+	0x02, 0x2F, 0x03, 0x90, // .@@@.          
+	0x00, 0x08, 0x1F, 0x0D, 0x02, 0x50, 0x02, 0x0C, 0x05, //  =@@#.      .#-
+	0x10, 0x0D, 0x1F, 0x0D, 0x07, 0x02, 0x10, 0x03, 0x08, 0x1F, 0x05, //   #@@#=.  .=@@-
+	0x10, 0x02, 0x0D, 0x8F, 0x0D, 0x02, //   .#@@@@@@@@@#.
+	0x30, 0x07, 0x0D, 0x4F, 0x0C, 0x07, 0x10, //     =#@@@@@#=  
+	0x50, 0x02, 0x25, 0x02, 0x30, //       .---.    
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @4234 'D' (16 pixels wide) */
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0x03, 0x65, 0x70, // .-------        
+	0x8F, 0x0D, 0x07, 0x02, 0x30, // @@@@@@@@@#=.    
+	0xAF, 0x0D, 0x05, 0x20, // @@@@@@@@@@@#-   
+	0x2F, 0x30, 0x02, 0x07, 0x0D, 0x2F, 0x05, 0x10, // @@@    .=#@@@-  
+	0x2F, 0x60, 0x0A, 0x2F, 0x02, 0x00, // @@@       *@@@. 
+	0x2F, 0x70, 0x0A, 0x1F, 0x08, 0x00, // @@@        *@@= 
+	0x2F, 0x70, 0x02, 0x2F, 0x00, // @@@        .@@@ 
+	0x2F, 0x80, 0x0C, 0x1F, 0x05, // @@@         #@@-
+	0x2F, 0x80, 0x08, 0x1F, 0x08, // @@@         =@@=
+	0x2F, 0x80, 0x05, 0x1F, 0x0A, // @@@         -@@*
+	0x2F, 0x80, 0x05, 0x1F, 0x0A, // @@@         -@@*
+	0x2F, 0x80, 0x05, 0x1F, 0x0A, // @@@         -@@*
+	0x2F, 0x80, 0x05, 0x1F, 0x0A, // @@@         -@@*
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0D, 0x1F, 0x03, // @@@         #@@.
+	0x2F, 0x70, 0x03, 0x1F, 0x0D, 0x00, // @@@        .@@# 
+	0x2F, 0x70, 0x0D, 0x1F, 0x07, 0x00, // @@@        #@@= 
+	0x2F, 0x50, 0x02, 0x0C, 0x1F, 0x0C, 0x10, // @@@      .#@@#  
+	0x2F, 0x35, 0x07, 0x0A, 0x2F, 0x0D, 0x02, 0x10, // @@@----=*@@@#.  
+	0xAF, 0x08, 0x30, // @@@@@@@@@@@=    
+	0x0D, 0x5F, 0x0D, 0x0A, 0x07, 0x02, 0x40, // #@@@@@@#*=.     
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+
+	/* @4357 'E' (12 pixels wide) */
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0x03, 0x95, 0x00, // .---------- 
+	0xAF, 0x05, // @@@@@@@@@@@-
+	0xAF, 0x03, // @@@@@@@@@@@.
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x8F, 0x0D, 0x10, // @@@@@@@@@#  
+	0x9F, 0x10, // @@@@@@@@@@  
+	0x2F, 0x55, 0x03, 0x10, // @@@------.  
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x80, // @@@         
+	0x2F, 0x75, 0x00, // @@@-------- 
+	0xAF, 0x05, // @@@@@@@@@@@-
+	0x0D, 0x9F, 0x03, // #@@@@@@@@@@.
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+
+	/* @4414 'F' (11 pixels wide) */
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0x03, 0x85, 0x02, // .---------.
+	0x9F, 0x0A, // @@@@@@@@@@*
+	0x9F, 0x08, // @@@@@@@@@@=
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x65, 0x00, // @@@------- 
+	0x9F, 0x05, // @@@@@@@@@@-
+	0x9F, 0x03, // @@@@@@@@@@.
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x0D, 0x0F, 0x0D, 0x70, // #@#        
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+
+	/* @4469 'G' (17 pixels wide) */
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0x50, 0x02, 0x05, 0x3A, 0x05, 0x02, 0x20, //       .-****-.   
+	0x30, 0x03, 0x0C, 0x7F, 0x0C, 0x03, 0x00, //     .#@@@@@@@@#. 
+	0x20, 0x05, 0x3F, 0x0C, 0x1A, 0x0C, 0x3F, 0x03, //    -@@@@#**#@@@@.
+	0x10, 0x05, 0x2F, 0x08, 0x02, 0x40, 0x07, 0x0D, 0x0F, 0x05, //   -@@@=.     =#@-
+	0x00, 0x03, 0x2F, 0x05, 0x80, 0x08, 0x02, //  .@@@-         =.
+	0x00, 0x0C, 0x1F, 0x07, 0xB0, //  #@@=            
+	0x03, 0x1F, 0x0D, 0xC0, // .@@#             
+	0x08, 0x1F, 0x08, 0xC0, // =@@=             
+	0x0C, 0x1F, 0x05, 0xC0, // #@@-             
+	0x2F, 0xD0, // @@@              
+	0x2F, 0x40, 0x03, 0x6F, 0x03, // @@@     .@@@@@@@.
+	0x2F, 0x40, 0x05, 0x6F, 0x05, // @@@     -@@@@@@@-
+	0x2F, 0x50, 0x35, 0x0C, 0x1F, 0x05, // @@@      ----#@@-
+	0x0C, 0x1F, 0x05, 0x80, 0x0A, 0x1F, 0x05, // #@@-         *@@-
+	0x08, 0x1F, 0x08, 0x80, 0x0A, 0x1F, 0x05, // =@@=         *@@-
+	0x03, 0x2F, 0x02, 0x70, 0x0A, 0x1F, 0x05, // .@@@.        *@@-
+	0x00, 0x0C, 0x1F, 0x0A, 0x70, 0x0A, 0x1F, 0x05, //  #@@*        *@@-
+	0x00, 0x03, 0x2F, 0x0A, 0x60, 0x0A, 0x1F, 0x05, //  .@@@*       *@@-
+	0x10, 0x05, 0x2F, 0x0C, 0x07, 0x02, 0x10, 0x03, 0x07, 0x0D, 0x1F, 0x05, //   -@@@#=.  .=#@@-
+	0x20, 0x05, 0x0D, 0xAF, 0x03, //    -#@@@@@@@@@@@.
+	0x30, 0x02, 0x08, 0x0D, 0x5F, 0x0C, 0x07, 0x02, 0x00, //     .=#@@@@@@#=. 
+	0x60, 0x02, 0x35, 0x40, //        .----     
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+
+	/* @4626 'H' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x03, 0x05, 0x03, 0x80, 0x15, 0x02, // .-.         --.
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x7A, 0x0C, 0x1F, 0x0A, // @@@********#@@*
+	0xDF, 0x0A, // @@@@@@@@@@@@@@*
+	0x2F, 0x7A, 0x0C, 0x1F, 0x0A, // @@@********#@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x2F, 0x70, 0x05, 0x1F, 0x0A, // @@@        -@@*
+	0x0D, 0x0F, 0x0D, 0x70, 0x03, 0x1F, 0x08, // #@#        .@@=
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @4740 'I' (3 pixels wide) */
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x03, 0x05, 0x03, // .-.
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x2F, // @@@
+	0x0D, 0x0F, 0x0D, // #@#
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+
+	/* @4774 'J' (8 pixels wide) */
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x40, 0x03, 0x05, 0x03, //      .-.
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x40, 0x2F, //      @@@
+	0x30, 0x02, 0x1F, 0x0D, //     .@@#
+	0x0A, 0x03, 0x10, 0x0A, 0x1F, 0x0A, // *.  *@@*
+	0x6F, 0x03, // @@@@@@@.
+	0x0A, 0x3F, 0x0D, 0x05, 0x00, // *@@@@#- 
+	0x00, 0x02, 0x15, 0x03, 0x20, //  .--.   
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+	0x70, //         
+
+	/* @4840 'K' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x03, 0x05, 0x03, 0x60, 0x02, 0x15, 0x00, // .-.       .-- 
+	0x2F, 0x50, 0x02, 0x1F, 0x0D, 0x00, // @@@      .@@# 
+	0x2F, 0x40, 0x02, 0x0D, 0x1F, 0x05, 0x00, // @@@     .#@@- 
+	0x2F, 0x40, 0x0A, 0x1F, 0x07, 0x10, // @@@     *@@=  
+	0x2F, 0x30, 0x08, 0x1F, 0x0A, 0x20, // @@@    =@@*   
+	0x2F, 0x20, 0x05, 0x1F, 0x0C, 0x30, // @@@   -@@#    
+	0x2F, 0x10, 0x02, 0x1F, 0x0D, 0x02, 0x30, // @@@  .@@#.    
+	0x2F, 0x00, 0x02, 0x0D, 0x0F, 0x0D, 0x02, 0x40, // @@@ .#@#.     
+	0x2F, 0x00, 0x0A, 0x1F, 0x05, 0x50, // @@@ *@@-      
+	0x2F, 0x08, 0x1F, 0x05, 0x60, // @@@=@@-       
+	0x2F, 0x0D, 0x1F, 0x03, 0x60, // @@@#@@.       
+	0x2F, 0x03, 0x1F, 0x0D, 0x02, 0x50, // @@@.@@#.      
+	0x2F, 0x00, 0x07, 0x1F, 0x0A, 0x50, // @@@ =@@*      
+	0x2F, 0x10, 0x0A, 0x1F, 0x07, 0x40, // @@@  *@@=     
+	0x2F, 0x10, 0x02, 0x0D, 0x1F, 0x03, 0x30, // @@@  .#@@.    
+	0x2F, 0x20, 0x05, 0x1F, 0x0D, 0x02, 0x20, // @@@   -@@#.   
+	0x2F, 0x30, 0x08, 0x1F, 0x0A, 0x20, // @@@    =@@*   
+	0x2F, 0x40, 0x0C, 0x1F, 0x07, 0x10, // @@@     #@@=  
+	0x2F, 0x40, 0x02, 0x0D, 0x1F, 0x03, 0x00, // @@@     .#@@. 
+	0x2F, 0x50, 0x05, 0x1F, 0x0D, 0x02, // @@@      -@@#.
+	0x0D, 0x0F, 0x0D, 0x60, 0x08, 0x1F, 0x05, // #@#       =@@-
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @4982 'L' (11 pixels wide) */
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0x03, 0x05, 0x03, 0x70, // .-.        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x65, 0x00, // @@@------- 
+	0x9F, 0x05, // @@@@@@@@@@-
+	0x0D, 0x8F, 0x03, // #@@@@@@@@@.
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+
+	/* @5037 'M' (22 pixels wide) */
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0x02, 0x25, 0xD0, 0x25, 0x02, // .---              ---.
+	0x0D, 0x2F, 0x0D, 0x02, 0xA0, 0x0D, 0x2F, 0x0D, // #@@@#.           #@@@#
+	0x4F, 0x08, 0x90, 0x05, 0x4F, // @@@@@=          -@@@@@
+	0x2F, 0x0C, 0x0F, 0x0D, 0x90, 0x0C, 0x0F, 0x0C, 0x2F, // @@@#@#          #@#@@@
+	0x2F, 0x07, 0x1F, 0x03, 0x70, 0x02, 0x1F, 0x05, 0x2F, // @@@=@@.        .@@-@@@
+	0x2F, 0x00, 0x1F, 0x0A, 0x70, 0x07, 0x1F, 0x00, 0x2F, // @@@ @@*        =@@ @@@
+	0x2F, 0x00, 0x0A, 0x1F, 0x70, 0x0D, 0x0F, 0x08, 0x00, 0x2F, // @@@ *@@        #@= @@@
+	0x2F, 0x00, 0x03, 0x1F, 0x07, 0x50, 0x03, 0x1F, 0x03, 0x00, 0x2F, // @@@ .@@=      .@@. @@@
+	0x2F, 0x10, 0x0D, 0x0F, 0x0C, 0x50, 0x0A, 0x0F, 0x0C, 0x10, 0x2F, // @@@  #@#      *@#  @@@
+	0x2F, 0x10, 0x08, 0x1F, 0x03, 0x30, 0x02, 0x1F, 0x07, 0x10, 0x2F, // @@@  =@@.    .@@=  @@@
+	0x2F, 0x10, 0x02, 0x1F, 0x08, 0x30, 0x07, 0x1F, 0x02, 0x10, 0x2F, // @@@  .@@=    =@@.  @@@
+	0x2F, 0x20, 0x0C, 0x0F, 0x0D, 0x30, 0x0C, 0x0F, 0x0A, 0x20, 0x2F, // @@@   #@#    #@*   @@@
+	0x2F, 0x20, 0x07, 0x1F, 0x05, 0x10, 0x03, 0x1F, 0x05, 0x20, 0x2F, // @@@   =@@-  .@@-   @@@
+	0x2F, 0x30, 0x1F, 0x0A, 0x10, 0x08, 0x0F, 0x0D, 0x30, 0x2F, // @@@    @@*  =@#    @@@
+	0x2F, 0x30, 0x0A, 0x1F, 0x02, 0x00, 0x1F, 0x08, 0x30, 0x2F, // @@@    *@@. @@=    @@@
+	0x2F, 0x30, 0x05, 0x1F, 0x07, 0x05, 0x1F, 0x02, 0x30, 0x2F, // @@@    -@@=-@@.    @@@
+	0x2F, 0x40, 0x0D, 0x0F, 0x1C, 0x0F, 0x0C, 0x40, 0x2F, // @@@     #@##@#     @@@
+	0x2F, 0x40, 0x08, 0x3F, 0x07, 0x40, 0x2F, // @@@     =@@@@=     @@@
+	0x2F, 0x40, 0x03, 0x3F, 0x50, 0x2F, // @@@     .@@@@      @@@
+	0x2F, 0x50, 0x0C, 0x1F, 0x0A, 0x50, 0x2F, // @@@      #@@*      @@@
+	0x0D, 0x0F, 0x0D, 0x50, 0x05, 0x1F, 0x03, 0x50, 0x0D, 0x0F, 0x0D, // #@#      -@@.      #@#
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+	0xF0, 0x50, //                       
+
+	/* @5246 'N' (16 pixels wide) */
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0x02, 0x15, 0x03, 0x70, 0x02, 0x15, 0x00, // .--.        .-- 
+	0x3F, 0x0A, 0x60, 0x0A, 0x1F, 0x05, // @@@@*       *@@-
+	0x4F, 0x03, 0x50, 0x0A, 0x1F, 0x05, // @@@@@.      *@@-
+	0x4F, 0x0C, 0x50, 0x0A, 0x1F, 0x05, // @@@@@#      *@@-
+	0x2F, 0x08, 0x1F, 0x03, 0x40, 0x0A, 0x1F, 0x05, // @@@=@@.     *@@-
+	0x2F, 0x03, 0x1F, 0x0C, 0x40, 0x0A, 0x1F, 0x05, // @@@.@@#     *@@-
+	0x2F, 0x00, 0x0C, 0x1F, 0x03, 0x30, 0x0A, 0x1F, 0x05, // @@@ #@@.    *@@-
+	0x2F, 0x00, 0x03, 0x1F, 0x08, 0x30, 0x0A, 0x1F, 0x05, // @@@ .@@=    *@@-
+	0x2F, 0x10, 0x0C, 0x1F, 0x02, 0x20, 0x0A, 0x1F, 0x05, // @@@  #@@.   *@@-
+	0x2F, 0x10, 0x03, 0x1F, 0x08, 0x20, 0x0A, 0x1F, 0x05, // @@@  .@@=   *@@-
+	0x2F, 0x20, 0x0C, 0x1F, 0x02, 0x10, 0x0A, 0x1F, 0x05, // @@@   #@@.  *@@-
+	0x2F, 0x20, 0x03, 0x1F, 0x08, 0x10, 0x0A, 0x1F, 0x05, // @@@   .@@=  *@@-
+	0x2F, 0x30, 0x0C, 0x1F, 0x02, 0x00, 0x0A, 0x1F, 0x05, // @@@    #@@. *@@-
+	0x2F, 0x30, 0x03, 0x1F, 0x08, 0x00, 0x0A, 0x1F, 0x05, // @@@    .@@= *@@-
+	0x2F, 0x40, 0x0C, 0x1F, 0x02, 0x0A, 0x1F, 0x05, // @@@     #@@.*@@-
+	0x2F, 0x40, 0x03, 0x1F, 0x08, 0x0A, 0x1F, 0x05, // @@@     .@@=*@@-
+	0x2F, 0x50, 0x0C, 0x1F, 0x0C, 0x1F, 0x05, // @@@      #@@#@@-
+	0x2F, 0x50, 0x03, 0x4F, 0x05, // @@@      .@@@@@-
+	0x2F, 0x60, 0x0C, 0x3F, 0x05, // @@@       #@@@@-
+	0x2F, 0x60, 0x03, 0x3F, 0x05, // @@@       .@@@@-
+	0x0D, 0x0F, 0x0D, 0x70, 0x05, 0x1F, 0x0D, 0x02, // #@#        -@@#.
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+
+	/* @5414 'O' (18 pixels wide) */
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0x50, 0x05, 0x3A, 0x07, 0x03, 0x40, //       -****=.     
+	0x20, 0x02, 0x08, 0x7F, 0x0C, 0x03, 0x20, //    .=@@@@@@@@#.   
+	0x10, 0x02, 0x0D, 0x2F, 0x0C, 0x1A, 0x0C, 0x3F, 0x05, 0x10, //   .#@@@#**#@@@@-  
+	0x00, 0x02, 0x0D, 0x1F, 0x0C, 0x03, 0x30, 0x02, 0x0A, 0x2F, 0x03, 0x00, //  .#@@#.    .*@@@. 
+	0x00, 0x08, 0x1F, 0x0C, 0x70, 0x0A, 0x1F, 0x0C, 0x00, //  =@@#        *@@# 
+	0x02, 0x2F, 0x02, 0x70, 0x02, 0x0D, 0x1F, 0x03, // .@@@.        .#@@.
+	0x05, 0x1F, 0x0A, 0x90, 0x08, 0x1F, 0x08, // -@@*          =@@=
+	0x0A, 0x1F, 0x05, 0x90, 0x05, 0x1F, 0x0A, // *@@-          -@@*
+	0x0D, 0x1F, 0x02, 0x90, 0x02, 0x2F, // #@@.          .@@@
+	0x2F, 0xB0, 0x2F, // @@@            @@@
+	0x2F, 0xB0, 0x2F, // @@@            @@@
+	0x2F, 0xB0, 0x2F, // @@@            @@@
+	0x2F, 0xB0, 0x2F, // @@@            @@@
+	0x0D, 0x1F, 0x03, 0x90, 0x05, 0x1F, 0x0A, // #@@.          -@@*
+	0x0A, 0x1F, 0x05, 0x90, 0x07, 0x1F, 0x08, // *@@-          =@@=
+	0x07, 0x1F, 0x0A, 0x90, 0x0C, 0x1F, 0x05, // =@@*          #@@-
+	0x02, 0x2F, 0x02, 0x70, 0x05, 0x1F, 0x0D, 0x00, // .@@@.        -@@# 
+	0x00, 0x08, 0x1F, 0x0D, 0x02, 0x50, 0x02, 0x0D, 0x1F, 0x05, 0x00, //  =@@#.      .#@@- 
+	0x00, 0x02, 0x0D, 0x1F, 0x0D, 0x07, 0x02, 0x10, 0x02, 0x08, 0x2F, 0x0A, 0x10, //  .#@@#=.  .=@@@*  
+	0x10, 0x02, 0x0D, 0x9F, 0x0A, 0x20, //   .#@@@@@@@@@@*   
+	0x30, 0x07, 0x0D, 0x5F, 0x0C, 0x03, 0x30, //     =#@@@@@@#.    
+	0x50, 0x02, 0x35, 0x60, //       .----       
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+	0xF0, 0x10, //                   
+
+	/* @5584 'P' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x03, 0x55, 0x02, 0x40, // .------.     
+	0x7F, 0x0D, 0x07, 0x20, // @@@@@@@@#=   
+	0x9F, 0x0A, 0x10, // @@@@@@@@@@*  
+	0x2F, 0x30, 0x07, 0x2F, 0x08, 0x00, // @@@    =@@@= 
+	0x2F, 0x40, 0x05, 0x2F, 0x00, // @@@     -@@@ 
+	0x2F, 0x50, 0x0C, 0x1F, 0x05, // @@@      #@@-
+	0x2F, 0x50, 0x0A, 0x1F, 0x05, // @@@      *@@-
+	0x2F, 0x50, 0x0A, 0x1F, 0x05, // @@@      *@@-
+	0x2F, 0x50, 0x0D, 0x1F, 0x02, // @@@      #@@.
+	0x2F, 0x40, 0x07, 0x1F, 0x0C, 0x00, // @@@     =@@# 
+	0x2F, 0x20, 0x02, 0x08, 0x2F, 0x05, 0x00, // @@@   .=@@@- 
+	0x9F, 0x07, 0x10, // @@@@@@@@@@=  
+	0x7F, 0x0C, 0x03, 0x20, // @@@@@@@@#.   
+	0x2F, 0x35, 0x50, // @@@----      
+	0x2F, 0x90, // @@@          
+	0x2F, 0x90, // @@@          
+	0x2F, 0x90, // @@@          
+	0x2F, 0x90, // @@@          
+	0x2F, 0x90, // @@@          
+	0x2F, 0x90, // @@@          
+	0x0D, 0x0F, 0x0D, 0x90, // #@#          
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @5674 'Q' (21 pixels wide) */
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0x50, 0x05, 0x3A, 0x07, 0x03, 0x70, //       -****=.        
+	0x20, 0x02, 0x08, 0x7F, 0x0C, 0x03, 0x50, //    .=@@@@@@@@#.      
+	0x10, 0x02, 0x0D, 0x2F, 0x0C, 0x1A, 0x0C, 0x3F, 0x05, 0x40, //   .#@@@#**#@@@@-     
+	0x00, 0x02, 0x0D, 0x1F, 0x0C, 0x03, 0x30, 0x02, 0x0A, 0x2F, 0x03, 0x30, //  .#@@#.    .*@@@.    
+	0x00, 0x08, 0x1F, 0x0C, 0x70, 0x0A, 0x1F, 0x0C, 0x30, //  =@@#        *@@#    
+	0x02, 0x2F, 0x02, 0x70, 0x02, 0x0D, 0x1F, 0x03, 0x20, // .@@@.        .#@@.   
+	0x07, 0x1F, 0x0A, 0x90, 0x08, 0x1F, 0x08, 0x20, // =@@*          =@@=   
+	0x0A, 0x1F, 0x05, 0x90, 0x05, 0x1F, 0x0A, 0x20, // *@@-          -@@*   
+	0x0D, 0x1F, 0x02, 0x90, 0x02, 0x2F, 0x20, // #@@.          .@@@   
+	0x2F, 0xB0, 0x2F, 0x20, // @@@            @@@   
+	0x2F, 0xB0, 0x2F, 0x20, // @@@            @@@   
+	0x2F, 0xB0, 0x2F, 0x20, // @@@            @@@   
+	0x2F, 0xB0, 0x2F, 0x20, // @@@            @@@   
+	0x0D, 0x1F, 0x03, 0x90, 0x05, 0x1F, 0x0C, 0x20, // #@@.          -@@#   
+	0x0A, 0x1F, 0x05, 0x90, 0x07, 0x1F, 0x0A, 0x20, // *@@-          =@@*   
+	0x07, 0x1F, 0x0A, 0x90, 0x0C, 0x1F, 0x05, 0x20, // =@@*          #@@-   
+	0x02, 0x2F, 0x02, 0x70, 0x05, 0x1F, 0x0D, 0x30, // .@@@.        -@@#    
+	0x00, 0x08, 0x1F, 0x0D, 0x02, 0x50, 0x02, 0x0D, 0x1F, 0x07, 0x30, //  =@@#.      .#@@=    
+	0x00, 0x02, 0x0D, 0x1F, 0x0D, 0x07, 0x02, 0x10, 0x02, 0x08, 0x2F, 0x0C, 0x40, //  .#@@#=.  .=@@@#     
+	0x10, 0x02, 0x0D, 0xBF, 0x07, 0x30, //   .#@@@@@@@@@@@@=    
+	0x30, 0x07, 0x0D, 0x5F, 0x08, 0x07, 0x2F, 0x0C, 0x03, 0x10, //     =#@@@@@@==@@@#.  
+	0x50, 0x02, 0x25, 0x03, 0x20, 0x02, 0x0D, 0x2F, 0x0C, 0x02, //       .---.   .#@@@#.
+	0xF0, 0x08, 0x2F, 0x05, //                 =@@@-
+	0xF0, 0x00, 0x02, 0x08, 0x0F, 0x03, //                  .=@.
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+
+	/* @5870 'R' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x03, 0x55, 0x03, 0x50, // .------.      
+	0x8F, 0x08, 0x02, 0x20, // @@@@@@@@@=.   
+	0x9F, 0x0D, 0x02, 0x10, // @@@@@@@@@@#.  
+	0x2F, 0x30, 0x05, 0x0D, 0x1F, 0x0C, 0x10, // @@@    -#@@#  
+	0x2F, 0x40, 0x02, 0x2F, 0x02, 0x00, // @@@     .@@@. 
+	0x2F, 0x50, 0x0A, 0x1F, 0x05, 0x00, // @@@      *@@- 
+	0x2F, 0x50, 0x0A, 0x1F, 0x05, 0x00, // @@@      *@@- 
+	0x2F, 0x50, 0x0D, 0x1F, 0x03, 0x00, // @@@      #@@. 
+	0x2F, 0x40, 0x05, 0x1F, 0x0C, 0x10, // @@@     -@@#  
+	0x2F, 0x35, 0x0C, 0x1F, 0x0D, 0x02, 0x10, // @@@----#@@#.  
+	0x8F, 0x0C, 0x02, 0x20, // @@@@@@@@@#.   
+	0x7F, 0x0D, 0x05, 0x30, // @@@@@@@@#-    
+	0x2F, 0x20, 0x07, 0x0D, 0x1F, 0x03, 0x20, // @@@   =#@@.   
+	0x2F, 0x30, 0x03, 0x1F, 0x0C, 0x20, // @@@    .@@#   
+	0x2F, 0x40, 0x08, 0x1F, 0x03, 0x10, // @@@     =@@.  
+	0x2F, 0x40, 0x03, 0x1F, 0x0C, 0x10, // @@@     .@@#  
+	0x2F, 0x50, 0x0C, 0x1F, 0x02, 0x00, // @@@      #@@. 
+	0x2F, 0x50, 0x07, 0x1F, 0x08, 0x00, // @@@      =@@= 
+	0x2F, 0x60, 0x1F, 0x0D, 0x00, // @@@       @@# 
+	0x2F, 0x60, 0x08, 0x1F, 0x05, // @@@       =@@-
+	0x0D, 0x0F, 0x0D, 0x60, 0x03, 0x1F, 0x08, // #@#       .@@=
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @5997 'S' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x20, 0x02, 0x05, 0x2A, 0x07, 0x03, 0x20, //    .-***=.   
+	0x10, 0x08, 0x6F, 0x0C, 0x02, 0x00, //   =@@@@@@@#. 
+	0x00, 0x0A, 0x2F, 0x0C, 0x1A, 0x2F, 0x05, 0x00, //  *@@@#**@@@- 
+	0x03, 0x1F, 0x0D, 0x03, 0x30, 0x07, 0x0D, 0x05, 0x00, // .@@#.    =#- 
+	0x08, 0x1F, 0x07, 0x80, // =@@=         
+	0x0A, 0x1F, 0x05, 0x80, // *@@-         
+	0x0A, 0x1F, 0x08, 0x80, // *@@=         
+	0x05, 0x2F, 0x05, 0x70, // -@@@-        
+	0x00, 0x0D, 0x2F, 0x08, 0x60, //  #@@@=       
+	0x00, 0x02, 0x0D, 0x3F, 0x08, 0x02, 0x30, //  .#@@@@=.    
+	0x10, 0x02, 0x0C, 0x4F, 0x07, 0x20, //   .#@@@@@=   
+	0x30, 0x03, 0x0C, 0x3F, 0x0A, 0x10, //     .#@@@@*  
+	0x50, 0x03, 0x0C, 0x2F, 0x08, 0x00, //       .#@@@= 
+	0x70, 0x0A, 0x2F, 0x00, //         *@@@ 
+	0x80, 0x0D, 0x1F, 0x05, //          #@@-
+	0x80, 0x0A, 0x1F, 0x05, //          *@@-
+	0x80, 0x0C, 0x1F, 0x05, //          #@@-
+	0x08, 0x02, 0x50, 0x03, 0x1F, 0x0D, 0x00, // =.      .@@# 
+	0x1F, 0x0A, 0x05, 0x20, 0x07, 0x0D, 0x1F, 0x07, 0x00, // @@*-   =#@@= 
+	0x0D, 0x8F, 0x0A, 0x10, // #@@@@@@@@@*  
+	0x02, 0x08, 0x0D, 0x4F, 0x0D, 0x07, 0x20, // .=#@@@@@#=   
+	0x20, 0x02, 0x25, 0x02, 0x40, //    .---.     
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @6129 'T' (16 pixels wide) */
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0x03, 0xD5, 0x02, // .--------------.
+	0xEF, 0x0A, // @@@@@@@@@@@@@@@*
+	0x0D, 0xDF, 0x08, // #@@@@@@@@@@@@@@=
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x0A, 0x1F, 0x05, 0x50, //       *@@-      
+	0x50, 0x08, 0x1F, 0x03, 0x50, //       =@@.      
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+
+	/* @6236 'U' (16 pixels wide) */
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0x03, 0x05, 0x03, 0x80, 0x02, 0x15, 0x00, // .-.         .-- 
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x2F, 0x80, 0x0A, 0x1F, 0x05, // @@@         *@@-
+	0x0D, 0x1F, 0x03, 0x70, 0x0D, 0x1F, 0x02, // #@@.        #@@.
+	0x0A, 0x1F, 0x08, 0x60, 0x03, 0x1F, 0x0D, 0x00, // *@@=       .@@# 
+	0x03, 0x2F, 0x03, 0x50, 0x0C, 0x1F, 0x08, 0x00, // .@@@.      #@@= 
+	0x00, 0x0A, 0x2F, 0x07, 0x02, 0x10, 0x05, 0x0C, 0x1F, 0x0D, 0x10, //  *@@@=.  -#@@#  
+	0x00, 0x02, 0x0C, 0x8F, 0x0D, 0x02, 0x10, //  .#@@@@@@@@@#.  
+	0x20, 0x07, 0x0D, 0x4F, 0x0D, 0x08, 0x30, //    =#@@@@@#=    
+	0x40, 0x02, 0x25, 0x02, 0x50, //      .---.      
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+
+	/* @6374 'V' (17 pixels wide) */
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0x15, 0x03, 0xA0, 0x02, 0x15, // --.           .--
+	0x0D, 0x1F, 0xA0, 0x0C, 0x1F, // #@@           #@@
+	0x08, 0x1F, 0x05, 0x80, 0x02, 0x1F, 0x0A, // =@@-         .@@*
+	0x03, 0x1F, 0x0A, 0x80, 0x07, 0x1F, 0x03, // .@@*         =@@.
+	0x00, 0x0D, 0x1F, 0x80, 0x0C, 0x0F, 0x0D, 0x00, //  #@@         #@# 
+	0x00, 0x08, 0x1F, 0x05, 0x60, 0x02, 0x1F, 0x08, 0x00, //  =@@-       .@@= 
+	0x00, 0x03, 0x1F, 0x0A, 0x60, 0x07, 0x1F, 0x03, 0x00, //  .@@*       =@@. 
+	0x10, 0x0C, 0x1F, 0x60, 0x0C, 0x0F, 0x0D, 0x10, //   #@@       #@#  
+	0x10, 0x07, 0x1F, 0x05, 0x40, 0x02, 0x1F, 0x08, 0x10, //   =@@-     .@@=  
+	0x10, 0x02, 0x1F, 0x0A, 0x40, 0x07, 0x1F, 0x02, 0x10, //   .@@*     =@@.  
+	0x20, 0x0C, 0x1F, 0x40, 0x0C, 0x0F, 0x0C, 0x20, //    #@@     #@#   
+	0x20, 0x07, 0x1F, 0x07, 0x20, 0x02, 0x1F, 0x07, 0x20, //    =@@=   .@@=   
+	0x20, 0x02, 0x1F, 0x0C, 0x20, 0x07, 0x1F, 0x02, 0x20, //    .@@#   =@@.   
+	0x30, 0x0A, 0x1F, 0x02, 0x10, 0x0C, 0x0F, 0x0C, 0x30, //     *@@.  #@#    
+	0x30, 0x05, 0x1F, 0x07, 0x00, 0x02, 0x1F, 0x07, 0x30, //     -@@= .@@=    
+	0x40, 0x1F, 0x0C, 0x00, 0x07, 0x1F, 0x40, //      @@# =@@     
+	0x40, 0x0A, 0x1F, 0x02, 0x0C, 0x0F, 0x0A, 0x40, //      *@@.#@*     
+	0x40, 0x05, 0x1F, 0x08, 0x1F, 0x05, 0x40, //      -@@=@@-     
+	0x50, 0x0D, 0x3F, 0x50, //       #@@@@      
+	0x50, 0x08, 0x2F, 0x0A, 0x50, //       =@@@*      
+	0x50, 0x03, 0x2F, 0x03, 0x50, //       .@@@.      
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+	0xF0, 0x00, //                  
+
+	/* @6548 'W' (27 pixels wide) */
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0x15, 0x03, 0x80, 0x15, 0x02, 0x80, 0x15, 0x02, // --.         --.         --.
+	0x1F, 0x0D, 0x70, 0x05, 0x1F, 0x0A, 0x70, 0x05, 0x1F, 0x05, // @@#        -@@*        -@@-
+	0x0A, 0x1F, 0x02, 0x60, 0x0A, 0x2F, 0x70, 0x08, 0x1F, 0x03, // *@@.       *@@@        =@@.
+	0x07, 0x1F, 0x05, 0x60, 0x0D, 0x2F, 0x05, 0x60, 0x0C, 0x0F, 0x0D, 0x00, // =@@-       #@@@-       #@# 
+	0x02, 0x1F, 0x0A, 0x50, 0x02, 0x3F, 0x08, 0x60, 0x1F, 0x0A, 0x00, // .@@*      .@@@@=       @@* 
+	0x00, 0x0D, 0x1F, 0x50, 0x05, 0x1F, 0x0C, 0x0F, 0x0D, 0x50, 0x05, 0x1F, 0x05, 0x00, //  #@@      -@@#@#      -@@- 
+	0x00, 0x08, 0x1F, 0x03, 0x40, 0x0A, 0x0F, 0x0A, 0x08, 0x1F, 0x02, 0x40, 0x0A, 0x1F, 0x10, //  =@@.     *@*=@@.     *@@  
+	0x00, 0x05, 0x1F, 0x07, 0x40, 0x1F, 0x07, 0x03, 0x1F, 0x05, 0x40, 0x0D, 0x0F, 0x0C, 0x10, //  -@@=     @@=.@@-     #@#  
+	0x10, 0x1F, 0x0C, 0x30, 0x03, 0x1F, 0x03, 0x00, 0x1F, 0x0A, 0x30, 0x02, 0x1F, 0x07, 0x10, //   @@#    .@@. @@*    .@@=  
+	0x10, 0x0A, 0x1F, 0x30, 0x07, 0x0F, 0x0D, 0x10, 0x0A, 0x1F, 0x30, 0x05, 0x1F, 0x02, 0x10, //   *@@    =@#  *@@    -@@.  
+	0x10, 0x07, 0x1F, 0x05, 0x20, 0x0A, 0x0F, 0x0A, 0x10, 0x07, 0x1F, 0x03, 0x20, 0x0A, 0x0F, 0x0D, 0x20, //   =@@-   *@*  =@@.   *@#   
+	0x10, 0x02, 0x1F, 0x08, 0x20, 0x1F, 0x05, 0x10, 0x02, 0x1F, 0x07, 0x20, 0x0D, 0x0F, 0x08, 0x20, //   .@@=   @@-  .@@=   #@=   
+	0x20, 0x0D, 0x0F, 0x0D, 0x10, 0x03, 0x1F, 0x02, 0x20, 0x0D, 0x0F, 0x0C, 0x10, 0x03, 0x1F, 0x05, 0x20, //    #@#  .@@.   #@#  .@@-   
+	0x20, 0x08, 0x1F, 0x02, 0x00, 0x07, 0x0F, 0x0D, 0x30, 0x08, 0x1F, 0x10, 0x07, 0x1F, 0x30, //    =@@. =@#    =@@  =@@    
+	0x20, 0x05, 0x1F, 0x05, 0x00, 0x0A, 0x0F, 0x0A, 0x30, 0x05, 0x1F, 0x05, 0x00, 0x0A, 0x0F, 0x0A, 0x30, //    -@@- *@*    -@@- *@*    
+	0x30, 0x1F, 0x0A, 0x00, 0x1F, 0x05, 0x40, 0x1F, 0x0A, 0x00, 0x1F, 0x07, 0x30, //     @@* @@-     @@* @@=    
+	0x30, 0x0A, 0x0F, 0x0D, 0x03, 0x1F, 0x02, 0x40, 0x0C, 0x0F, 0x0D, 0x03, 0x1F, 0x02, 0x30, //     *@#.@@.     #@#.@@.    
+	0x30, 0x05, 0x1F, 0x0A, 0x0F, 0x0D, 0x50, 0x07, 0x1F, 0x08, 0x0F, 0x0D, 0x40, //     -@@*@#      =@@=@#     
+	0x30, 0x02, 0x3F, 0x0A, 0x50, 0x03, 0x3F, 0x08, 0x40, //     .@@@@*      .@@@@=     
+	0x40, 0x0C, 0x2F, 0x05, 0x60, 0x0D, 0x2F, 0x05, 0x40, //      #@@@-       #@@@-     
+	0x40, 0x08, 0x1F, 0x0D, 0x02, 0x60, 0x08, 0x1F, 0x0D, 0x50, //      =@@#.       =@@#      
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+	0xF0, 0xA0, //                            
+
+	/* @6842 'X' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x03, 0x15, 0x80, 0x03, 0x05, 0x03, // .--         .-.
+	0x08, 0x1F, 0x08, 0x60, 0x02, 0x1F, 0x0C, // =@@=       .@@#
+	0x00, 0x0D, 0x1F, 0x03, 0x50, 0x0C, 0x1F, 0x03, //  #@@.      #@@.
+	0x00, 0x05, 0x1F, 0x0C, 0x40, 0x03, 0x1F, 0x08, 0x00, //  -@@#     .@@= 
+	0x10, 0x0C, 0x1F, 0x05, 0x30, 0x0D, 0x1F, 0x02, 0x00, //   #@@-    #@@. 
+	0x10, 0x02, 0x1F, 0x0D, 0x20, 0x07, 0x1F, 0x07, 0x10, //   .@@#   =@@=  
+	0x20, 0x08, 0x1F, 0x07, 0x00, 0x02, 0x0D, 0x0F, 0x0D, 0x20, //    =@@= .#@#   
+	0x20, 0x02, 0x0D, 0x1F, 0x02, 0x08, 0x1F, 0x03, 0x20, //    .#@@.=@@.   
+	0x30, 0x07, 0x1F, 0x0A, 0x1F, 0x0A, 0x30, //     =@@*@@*    
+	0x40, 0x0C, 0x3F, 0x02, 0x30, //      #@@@@.    
+	0x40, 0x05, 0x2F, 0x08, 0x40, //      -@@@=     
+	0x40, 0x08, 0x2F, 0x0D, 0x40, //      =@@@#     
+	0x30, 0x03, 0x1F, 0x0D, 0x1F, 0x08, 0x30, //     .@@#@@=    
+	0x30, 0x0C, 0x1F, 0x02, 0x0D, 0x1F, 0x02, 0x20, //     #@@.#@@.   
+	0x20, 0x07, 0x1F, 0x07, 0x00, 0x03, 0x1F, 0x0C, 0x20, //    =@@= .@@#   
+	0x10, 0x02, 0x0D, 0x0F, 0x0D, 0x20, 0x0C, 0x1F, 0x03, 0x10, //   .#@#   #@@.  
+	0x10, 0x08, 0x1F, 0x05, 0x20, 0x02, 0x1F, 0x0D, 0x10, //   =@@-   .@@#  
+	0x00, 0x03, 0x1F, 0x0C, 0x40, 0x08, 0x1F, 0x07, 0x00, //  .@@#     =@@= 
+	0x00, 0x0C, 0x1F, 0x03, 0x40, 0x02, 0x2F, 0x02, //  #@@.     .@@@.
+	0x07, 0x1F, 0x08, 0x60, 0x07, 0x1F, 0x08, // =@@=       =@@=
+	0x0C, 0x0F, 0x0D, 0x02, 0x70, 0x0D, 0x1F, // #@#.        #@@
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @7014 'Y' (15 pixels wide) */
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0x15, 0x03, 0x80, 0x03, 0x05, 0x03, // --.         .-.
+	0x0C, 0x1F, 0x03, 0x60, 0x02, 0x1F, 0x0C, // #@@.       .@@#
+	0x03, 0x1F, 0x08, 0x60, 0x08, 0x1F, 0x03, // .@@=       =@@.
+	0x00, 0x0C, 0x1F, 0x02, 0x40, 0x02, 0x1F, 0x0C, 0x00, //  #@@.     .@@# 
+	0x00, 0x03, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x03, 0x00, //  .@@=     =@@. 
+	0x10, 0x0C, 0x1F, 0x02, 0x20, 0x02, 0x1F, 0x0C, 0x10, //   #@@.   .@@#  
+	0x10, 0x03, 0x1F, 0x08, 0x20, 0x07, 0x1F, 0x03, 0x10, //   .@@=   =@@.  
+	0x20, 0x0C, 0x1F, 0x02, 0x10, 0x0D, 0x0F, 0x0C, 0x20, //    #@@.  #@#   
+	0x20, 0x03, 0x1F, 0x08, 0x00, 0x07, 0x1F, 0x03, 0x20, //    .@@= =@@.   
+	0x30, 0x0C, 0x1F, 0x02, 0x0D, 0x0F, 0x0C, 0x30, //     #@@.#@#    
+	0x30, 0x03, 0x1F, 0x0D, 0x1F, 0x03, 0x30, //     .@@#@@.    
+	0x40, 0x0C, 0x2F, 0x0C, 0x40, //      #@@@#     
+	0x40, 0x03, 0x2F, 0x03, 0x40, //      .@@@.     
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x2F, 0x50, //       @@@      
+	0x50, 0x0D, 0x0F, 0x0D, 0x50, //       #@#      
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+	0xE0, //                
+
+	/* @7148 'Z' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x03, 0xA5, 0x03, 0x00, // .-----------. 
+	0x0D, 0xAF, 0x0D, 0x00, // #@@@@@@@@@@@# 
+	0x0C, 0xBF, 0x00, // #@@@@@@@@@@@@ 
+	0x80, 0x07, 0x1F, 0x08, 0x00, //          =@@= 
+	0x70, 0x02, 0x0D, 0x0F, 0x0D, 0x02, 0x00, //         .#@#. 
+	0x70, 0x0A, 0x1F, 0x05, 0x10, //         *@@-  
+	0x60, 0x05, 0x1F, 0x0A, 0x20, //        -@@*   
+	0x60, 0x0D, 0x0F, 0x0D, 0x02, 0x20, //        #@#.   
+	0x50, 0x08, 0x1F, 0x07, 0x30, //       =@@=    
+	0x40, 0x03, 0x1F, 0x0C, 0x40, //      .@@#     
+	0x40, 0x0D, 0x1F, 0x02, 0x40, //      #@@.     
+	0x30, 0x08, 0x1F, 0x07, 0x50, //     =@@=      
+	0x20, 0x02, 0x1F, 0x0D, 0x60, //    .@@#       
+	0x20, 0x0C, 0x1F, 0x03, 0x60, //    #@@.       
+	0x10, 0x07, 0x1F, 0x08, 0x70, //   =@@=        
+	0x00, 0x02, 0x1F, 0x0D, 0x80, //  .@@#         
+	0x00, 0x0A, 0x1F, 0x03, 0x80, //  *@@.         
+	0x05, 0x1F, 0x0A, 0x90, // -@@*          
+	0x0D, 0x1F, 0x07, 0x85, 0x00, // #@@=--------- 
+	0xCF, 0x05, // @@@@@@@@@@@@@-
+	0x0D, 0xBF, 0x03, // #@@@@@@@@@@@@.
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @7255 '[' (6 pixels wide) */
+	0x50, //       
+	0x50, //       
+	0x0D, 0x3F, 0x05, // #@@@@-
+	0x4F, 0x05, // @@@@@-
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x1F, 0x05, 0x20, // @@-   
+	0x4F, 0x05, // @@@@@-
+	0x0D, 0x3F, 0x05, // #@@@@-
+	0x50, //       
+
+	/* @7337 '\\' (12 pixels wide) */
+	0xB0, //             
+	0x1F, 0x07, 0x80, // @@=         
+	0x0C, 0x0F, 0x0C, 0x80, // #@#         
+	0x07, 0x1F, 0x03, 0x70, // =@@.        
+	0x02, 0x1F, 0x08, 0x70, // .@@=        
+	0x00, 0x0A, 0x0F, 0x0D, 0x70, //  *@#        
+	0x00, 0x05, 0x1F, 0x03, 0x60, //  -@@.       
+	0x10, 0x1F, 0x0A, 0x60, //   @@*       
+	0x10, 0x0A, 0x1F, 0x60, //   *@@       
+	0x10, 0x03, 0x1F, 0x05, 0x50, //   .@@-      
+	0x20, 0x0D, 0x0F, 0x0C, 0x50, //    #@#      
+	0x20, 0x08, 0x1F, 0x02, 0x40, //    =@@.     
+	0x20, 0x03, 0x1F, 0x07, 0x40, //    .@@=     
+	0x30, 0x0C, 0x0F, 0x0C, 0x40, //     #@#     
+	0x30, 0x07, 0x1F, 0x03, 0x30, //     =@@.    
+	0x30, 0x02, 0x1F, 0x08, 0x30, //     .@@=    
+	0x40, 0x0C, 0x0F, 0x0D, 0x30, //      #@#    
+	0x40, 0x05, 0x1F, 0x03, 0x20, //      -@@.   
+	0x50, 0x1F, 0x0A, 0x20, //       @@*   
+	0x50, 0x0A, 0x1F, 0x20, //       *@@   
+	0x50, 0x03, 0x1F, 0x05, 0x10, //       .@@-  
+	0x60, 0x0D, 0x0F, 0x0C, 0x10, //        #@#  
+	0x60, 0x08, 0x1F, 0x02, 0x00, //        =@@. 
+	0x60, 0x03, 0x1F, 0x07, 0x00, //        .@@= 
+	0x70, 0x0C, 0x0F, 0x0C, 0x00, //         #@# 
+	0x70, 0x07, 0x1F, 0x02, //         =@@.
+	0x70, 0x02, 0x1F, 0x08, //         .@@=
+	0x80, 0x0C, 0x0F, 0x0D, //          #@#
+	0x80, 0x02, 0x15, //          .--
+	0xB0, //             
+
+	/* @7465 ']' (6 pixels wide) */
+	0x50, //       
+	0x50, //       
+	0x0D, 0x3F, 0x03, // #@@@@.
+	0x0D, 0x3F, 0x0A, // #@@@@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x20, 0x1F, 0x0A, //    @@*
+	0x0D, 0x3F, 0x0A, // #@@@@*
+	0x0D, 0x3F, 0x03, // #@@@@.
+	0x50, //       
+
+	/* @7549 '^' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x40, 0x15, 0x02, 0x40, //      --.     
+	0x30, 0x08, 0x1F, 0x0D, 0x40, //     =@@#     
+	0x30, 0x3F, 0x07, 0x30, //     @@@@=    
+	0x20, 0x07, 0x1F, 0x0C, 0x0F, 0x0D, 0x30, //    =@@#@#    
+	0x20, 0x0D, 0x0F, 0x08, 0x03, 0x1F, 0x03, 0x20, //    #@=.@@.   
+	0x10, 0x03, 0x1F, 0x03, 0x00, 0x0D, 0x0F, 0x0C, 0x20, //   .@@. #@#   
+	0x10, 0x0C, 0x0F, 0x0C, 0x10, 0x07, 0x1F, 0x03, 0x10, //   #@#  =@@.  
+	0x00, 0x02, 0x1F, 0x07, 0x10, 0x02, 0x1F, 0x08, 0x10, //  .@@=  .@@=  
+	0x00, 0x08, 0x1F, 0x30, 0x08, 0x1F, 0x02, 0x00, //  =@@    =@@. 
+	0x02, 0x1F, 0x08, 0x30, 0x03, 0x1F, 0x08, 0x00, // .@@=    .@@= 
+	0x07, 0x1F, 0x03, 0x40, 0x0C, 0x0F, 0x0D, 0x00, // =@@.     #@# 
+	0x0D, 0x0F, 0x0C, 0x50, 0x07, 0x1F, 0x07, // #@#      =@@=
+	0x15, 0x02, 0x60, 0x15, 0x02, // --.       --.
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @7657 '_' (16 pixels wide) */
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0xF0, //                 
+	0x03, 0xD5, 0x03, // .--------------.
+	0xFF, // @@@@@@@@@@@@@@@@
+	0x08, 0xDA, 0x08, // =**************=
+
+	/* @7691 '`' (5 pixels wide) */
+	0x40, //      
+	0x15, 0x02, 0x10, // --.  
+	0x0D, 0x0F, 0x0D, 0x10, // #@#  
+	0x02, 0x1F, 0x07, 0x00, // .@@= 
+	0x00, 0x05, 0x1F, 0x02, //  -@@.
+	0x10, 0x0A, 0x0F, 0x0C, //   *@#
+	0x20, 0x08, 0x0A, //    =*
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+	0x40, //      
+
+	/* @7737 'a' (12 pixels wide) */
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0x30, 0x03, 0x25, 0x30, //     .---    
+	0x00, 0x02, 0x08, 0x5F, 0x08, 0x02, 0x00, //  .=@@@@@@=. 
+	0x03, 0x2F, 0x0C, 0x1A, 0x2F, 0x0C, 0x00, // .@@@#**@@@# 
+	0x05, 0x0F, 0x08, 0x02, 0x30, 0x0A, 0x1F, 0x05, // -@=.    *@@-
+	0x00, 0x03, 0x50, 0x03, 0x1F, 0x08, //  .      .@@=
+	0x80, 0x1F, 0x0A, //          @@*
+	0x80, 0x1F, 0x0A, //          @@*
+	0x10, 0x02, 0x08, 0x0C, 0x5F, 0x0A, //   .=#@@@@@@*
+	0x00, 0x08, 0x8F, 0x0A, //  =@@@@@@@@@*
+	0x05, 0x1F, 0x0D, 0x05, 0x30, 0x1F, 0x0A, // -@@#-    @@*
+	0x0C, 0x0F, 0x0D, 0x02, 0x40, 0x1F, 0x0A, // #@#.     @@*
+	0x1F, 0x0A, 0x50, 0x1F, 0x0A, // @@*      @@*
+	0x1F, 0x0C, 0x40, 0x05, 0x1F, 0x0A, // @@#     -@@*
+	0x0C, 0x1F, 0x05, 0x20, 0x07, 0x2F, 0x0A, // #@@-   =@@@*
+	0x03, 0x2F, 0x0C, 0x0A, 0x0D, 0x0F, 0x0D, 0x0C, 0x0F, 0x0A, // .@@@#*#@##@*
+	0x00, 0x05, 0x0D, 0x3F, 0x08, 0x02, 0x08, 0x0F, 0x0A, //  -#@@@@=.=@*
+	0x20, 0x03, 0x15, 0x02, 0x40, //    .--.     
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+
+	/* @7854 'b' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0x08, 0x0A, 0x05, 0x90, // =*-          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x20, 0x15, 0x03, 0x30, // @@*   --.    
+	0x1F, 0x0A, 0x00, 0x08, 0x3F, 0x0D, 0x05, 0x10, // @@* =@@@@#-  
+	0x1F, 0x1A, 0x6F, 0x05, 0x00, // @@**@@@@@@@- 
+	0x3F, 0x0C, 0x03, 0x00, 0x02, 0x0A, 0x2F, 0x02, // @@@@#. .*@@@.
+	0x2F, 0x0A, 0x40, 0x0C, 0x1F, 0x07, // @@@*     #@@=
+	0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x0A, // @@#      =@@*
+	0x1F, 0x0A, 0x50, 0x02, 0x2F, // @@*      .@@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x50, 0x03, 0x1F, 0x0D, // @@*      .@@#
+	0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x0A, // @@#      =@@*
+	0x2F, 0x0A, 0x40, 0x0D, 0x1F, 0x05, // @@@*     #@@-
+	0x3F, 0x0C, 0x03, 0x00, 0x02, 0x0A, 0x1F, 0x0D, 0x00, // @@@@#. .*@@# 
+	0x1F, 0x07, 0x0D, 0x6F, 0x03, 0x00, // @@=#@@@@@@@. 
+	0x1F, 0x05, 0x02, 0x0A, 0x3F, 0x0C, 0x02, 0x10, // @@-.*@@@@#.  
+	0x40, 0x02, 0x15, 0x02, 0x30, //      .--.    
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @7982 'c' (11 pixels wide) */
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0x40, 0x25, 0x20, //      ---   
+	0x10, 0x02, 0x08, 0x4F, 0x08, 0x00, //   .=@@@@@= 
+	0x00, 0x02, 0x0D, 0x6F, 0x0A, //  .#@@@@@@@*
+	0x00, 0x0C, 0x1F, 0x0C, 0x03, 0x10, 0x07, 0x0D, 0x0F, //  #@@#.  =#@
+	0x03, 0x1F, 0x0D, 0x40, 0x02, 0x08, // .@@#     .=
+	0x0A, 0x1F, 0x07, 0x60, // *@@=       
+	0x0D, 0x1F, 0x03, 0x60, // #@@.       
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x70, // @@@        
+	0x2F, 0x02, 0x60, // @@@.       
+	0x0A, 0x1F, 0x07, 0x60, // *@@=       
+	0x07, 0x1F, 0x0D, 0x40, 0x02, 0x08, // =@@#     .=
+	0x00, 0x0D, 0x1F, 0x0C, 0x03, 0x10, 0x07, 0x0D, 0x0F, //  #@@#.  =#@
+	0x00, 0x05, 0x7F, 0x0C, //  -@@@@@@@@#
+	0x10, 0x03, 0x0C, 0x3F, 0x0D, 0x08, 0x00, //   .#@@@@#= 
+	0x30, 0x02, 0x15, 0x03, 0x20, //     .--.   
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+	0xA0, //            
+
+	/* @8076 'd' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0x90, 0x05, 0x0A, 0x08, //           -*=
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x30, 0x02, 0x15, 0x02, 0x10, 0x0A, 0x1F, //     .--.  *@@
+	0x10, 0x03, 0x0C, 0x3F, 0x0A, 0x02, 0x0A, 0x1F, //   .#@@@@*.*@@
+	0x00, 0x03, 0x6F, 0x0D, 0x0C, 0x1F, //  .@@@@@@@##@@
+	0x00, 0x0D, 0x1F, 0x0A, 0x02, 0x00, 0x03, 0x0C, 0x3F, //  #@@*. .#@@@@
+	0x05, 0x1F, 0x0D, 0x40, 0x0A, 0x2F, // -@@#     *@@@
+	0x0A, 0x1F, 0x07, 0x50, 0x0C, 0x1F, // *@@=      #@@
+	0x0D, 0x1F, 0x03, 0x50, 0x0A, 0x1F, // #@@.      *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x02, 0x50, 0x0A, 0x1F, // @@@.      *@@
+	0x0A, 0x1F, 0x07, 0x50, 0x0C, 0x1F, // *@@=      #@@
+	0x07, 0x1F, 0x0C, 0x40, 0x0A, 0x2F, // =@@#     *@@@
+	0x02, 0x2F, 0x0A, 0x02, 0x00, 0x03, 0x0C, 0x3F, // .@@@*. .#@@@@
+	0x00, 0x05, 0x6F, 0x0D, 0x07, 0x1F, //  -@@@@@@@#=@@
+	0x10, 0x05, 0x0D, 0x3F, 0x08, 0x00, 0x05, 0x1F, //   -#@@@@= -@@
+	0x30, 0x03, 0x15, 0x50, //     .--      
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @8205 'e' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x40, 0x25, 0x02, 0x30, //      ---.    
+	0x20, 0x08, 0x4F, 0x0D, 0x05, 0x10, //    =@@@@@#-  
+	0x00, 0x02, 0x0D, 0x1F, 0x0D, 0x1A, 0x2F, 0x05, 0x00, //  .#@@#**@@@- 
+	0x00, 0x0A, 0x1F, 0x07, 0x20, 0x02, 0x0C, 0x1F, 0x02, //  *@@=   .#@@.
+	0x03, 0x1F, 0x0A, 0x40, 0x02, 0x1F, 0x08, // .@@*     .@@=
+	0x08, 0x1F, 0x03, 0x50, 0x0C, 0x0F, 0x0C, // =@@.      #@#
+	0x0C, 0x1F, 0x60, 0x0A, 0x1F, // #@@       *@@
+	0xCF, // @@@@@@@@@@@@@
+	0xBF, 0x0D, // @@@@@@@@@@@@#
+	0x2F, 0x90, // @@@          
+	0x0D, 0x1F, 0x90, // #@@          
+	0x0A, 0x1F, 0x05, 0x80, // *@@-         
+	0x05, 0x1F, 0x0C, 0x80, // -@@#         
+	0x00, 0x0D, 0x1F, 0x0A, 0x40, 0x03, 0x08, 0x03, //  #@@*     .=.
+	0x00, 0x02, 0x0D, 0x2F, 0x2A, 0x0D, 0x1F, 0x05, //  .#@@@***#@@-
+	0x10, 0x02, 0x08, 0x5F, 0x0D, 0x08, 0x00, //   .=@@@@@@#= 
+	0x40, 0x35, 0x30, //      ----    
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @8307 'f' (10 pixels wide) */
+	0x90, //           
+	0x90, //           
+	0x30, 0x08, 0x0D, 0x1F, 0x0C, 0x02, //     =#@@#.
+	0x20, 0x0A, 0x4F, 0x05, //    *@@@@@-
+	0x10, 0x03, 0x1F, 0x0A, 0x10, 0x05, 0x02, //   .@@*  -.
+	0x10, 0x07, 0x1F, 0x03, 0x30, //   =@@.    
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x7F, 0x08, 0x00, // @@@@@@@@= 
+	0x7F, 0x08, 0x00, // @@@@@@@@= 
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x0A, 0x1F, 0x40, //   *@@     
+	0x10, 0x08, 0x0F, 0x0D, 0x40, //   =@#     
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+
+	/* @8408 'g' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x40, 0x25, 0x50, //      ---      
+	0x10, 0x02, 0x08, 0x8F, 0x03, //   .=@@@@@@@@@.
+	0x10, 0x0D, 0x1F, 0x0C, 0x0A, 0x0D, 0x4F, 0x03, //   #@@#*#@@@@@.
+	0x00, 0x08, 0x1F, 0x05, 0x20, 0x08, 0x1F, 0x02, 0x10, //  =@@-   =@@.  
+	0x00, 0x0D, 0x0F, 0x08, 0x40, 0x0D, 0x0F, 0x08, 0x10, //  #@=     #@=  
+	0x00, 0x1F, 0x05, 0x40, 0x0A, 0x0F, 0x0A, 0x10, //  @@-     *@*  
+	0x00, 0x1F, 0x05, 0x40, 0x0A, 0x0F, 0x0A, 0x10, //  @@-     *@*  
+	0x00, 0x0C, 0x0F, 0x0C, 0x30, 0x02, 0x1F, 0x07, 0x10, //  #@#    .@@=  
+	0x00, 0x05, 0x1F, 0x08, 0x02, 0x00, 0x03, 0x0C, 0x1F, 0x02, 0x10, //  -@@=. .#@@.  
+	0x00, 0x05, 0x7F, 0x05, 0x20, //  -@@@@@@@@-   
+	0x00, 0x0D, 0x0F, 0x07, 0x0A, 0x2F, 0x0A, 0x02, 0x30, //  #@=*@@@*.    
+	0x05, 0x1F, 0xA0, // -@@           
+	0x05, 0x1F, 0x07, 0x90, // -@@=          
+	0x00, 0x0D, 0x5F, 0x0D, 0x0A, 0x08, 0x02, 0x10, //  #@@@@@@#*=.  
+	0x00, 0x05, 0x9F, 0x05, 0x00, //  -@@@@@@@@@@- 
+	0x03, 0x1F, 0x0A, 0x30, 0x02, 0x07, 0x0D, 0x1F, 0x02, // .@@*    .=#@@.
+	0x0C, 0x0F, 0x0D, 0x60, 0x07, 0x1F, 0x05, // #@#       =@@-
+	0x1F, 0x0A, 0x60, 0x05, 0x1F, 0x05, // @@*       -@@-
+	0x1F, 0x0D, 0x02, 0x40, 0x02, 0x0D, 0x1F, 0x00, // @@#.     .#@@ 
+	0x08, 0x1F, 0x0D, 0x08, 0x25, 0x08, 0x0D, 0x1F, 0x05, 0x00, // =@@#=---=#@@- 
+	0x00, 0x08, 0x7F, 0x0D, 0x05, 0x10, //  =@@@@@@@@#-  
+	0x10, 0x02, 0x05, 0x3A, 0x08, 0x05, 0x30, //   .-****=-    
+
+	/* @8573 'h' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0x08, 0x0A, 0x05, 0x90, // =*-          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x20, 0x15, 0x03, 0x30, // @@*   --.    
+	0x1F, 0x0A, 0x00, 0x08, 0x3F, 0x0D, 0x05, 0x10, // @@* =@@@@#-  
+	0x1F, 0x1C, 0x6F, 0x03, 0x00, // @@##@@@@@@@. 
+	0x3F, 0x0D, 0x03, 0x00, 0x02, 0x0A, 0x1F, 0x0C, 0x00, // @@@@#. .*@@# 
+	0x2F, 0x0A, 0x40, 0x0C, 0x1F, 0x02, // @@@*     #@@.
+	0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x05, // @@#      =@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x0D, 0x0F, 0x08, 0x50, 0x03, 0x1F, 0x03, // #@=      .@@.
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @8701 'i' (4 pixels wide) */
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x05, 0x0A, 0x08, 0x00, // -*= 
+	0x2F, 0x05, // @@@-
+	0x0D, 0x1F, 0x03, // #@@.
+	0x02, 0x05, 0x03, 0x00, // .-. 
+	0x30, //     
+	0x30, //     
+	0x08, 0x0F, 0x0D, 0x00, // =@# 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x0A, 0x1F, 0x00, // *@@ 
+	0x08, 0x0F, 0x0D, 0x00, // =@# 
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+	0x30, //     
+
+	/* @8772 'j' (7 pixels wide) */
+	0x60, //        
+	0x60, //        
+	0x60, //        
+	0x20, 0x05, 0x0A, 0x08, 0x00, //    -*= 
+	0x20, 0x2F, 0x05, //    @@@-
+	0x20, 0x0D, 0x1F, 0x03, //    #@@.
+	0x20, 0x02, 0x05, 0x03, 0x00, //    .-. 
+	0x60, //        
+	0x60, //        
+	0x20, 0x08, 0x0F, 0x0D, 0x00, //    =@# 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x20, 0x0A, 0x1F, 0x00, //    *@@ 
+	0x10, 0x02, 0x1F, 0x0C, 0x00, //   .@@# 
+	0x1A, 0x0D, 0x1F, 0x08, 0x00, // **#@@= 
+	0x3F, 0x0D, 0x10, // @@@@#  
+	0x07, 0x1A, 0x07, 0x20, // =**=   
+
+	/* @8880 'k' (12 pixels wide) */
+	0xB0, //             
+	0xB0, //             
+	0x08, 0x0A, 0x05, 0x80, // =*-         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x80, // @@*         
+	0x1F, 0x0A, 0x30, 0x02, 0x0D, 0x1F, 0x00, // @@*    .#@@ 
+	0x1F, 0x0A, 0x20, 0x02, 0x0D, 0x1F, 0x05, 0x00, // @@*   .#@@- 
+	0x1F, 0x0A, 0x20, 0x0C, 0x1F, 0x05, 0x10, // @@*   #@@-  
+	0x1F, 0x0A, 0x10, 0x0A, 0x1F, 0x05, 0x20, // @@*  *@@-   
+	0x1F, 0x0A, 0x00, 0x0A, 0x1F, 0x05, 0x30, // @@* *@@-    
+	0x1F, 0x1A, 0x1F, 0x07, 0x40, // @@**@@=     
+	0x1F, 0x0D, 0x1F, 0x0D, 0x50, // @@#@@#      
+	0x1F, 0x1A, 0x1F, 0x08, 0x40, // @@**@@=     
+	0x1F, 0x0A, 0x02, 0x0D, 0x1F, 0x05, 0x30, // @@*.#@@-    
+	0x1F, 0x0A, 0x00, 0x03, 0x1F, 0x0D, 0x02, 0x20, // @@* .@@#.   
+	0x1F, 0x0A, 0x10, 0x07, 0x1F, 0x0C, 0x20, // @@*  =@@#   
+	0x1F, 0x0A, 0x20, 0x0A, 0x1F, 0x08, 0x10, // @@*   *@@=  
+	0x1F, 0x0A, 0x30, 0x0D, 0x1F, 0x05, 0x00, // @@*    #@@- 
+	0x1F, 0x0A, 0x30, 0x02, 0x2F, 0x02, // @@*    .@@@.
+	0x0D, 0x0F, 0x08, 0x40, 0x05, 0x1F, 0x08, // #@=     -@@=
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+
+	/* @9010 'l' (3 pixels wide) */
+	0x20, //    
+	0x20, //    
+	0x08, 0x0A, 0x05, // =*-
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x0D, 0x0F, 0x08, // #@=
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+	0x20, //    
+
+	/* @9064 'm' (21 pixels wide) */
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0x50, 0x15, 0x03, 0x50, 0x15, 0x03, 0x20, //       --.      --.   
+	0x1F, 0x05, 0x00, 0x08, 0x3F, 0x0C, 0x02, 0x10, 0x05, 0x0D, 0x2F, 0x0D, 0x02, 0x00, // @@- =@@@@#.  -#@@@#. 
+	0x1F, 0x05, 0x0A, 0x5F, 0x0D, 0x00, 0x08, 0x5F, 0x0D, 0x02, // @@-*@@@@@@# =@@@@@@#.
+	0x1F, 0x0D, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0D, 0x1F, 0x0A, 0x0F, 0x0D, 0x05, 0x00, 0x02, 0x0A, 0x1F, 0x08, // @@#@#. .#@@*@#- .*@@=
+	0x2F, 0x0A, 0x30, 0x02, 0x2F, 0x0D, 0x02, 0x20, 0x02, 0x1F, 0x0C, // @@@*    .@@@#.   .@@#
+	0x1F, 0x0C, 0x50, 0x0C, 0x1F, 0x02, 0x40, 0x0C, 0x1F, // @@#      #@@.     #@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x50, 0x0A, 0x1F, // @@*      *@@      *@@
+	0x0D, 0x0F, 0x08, 0x50, 0x08, 0x0F, 0x0D, 0x50, 0x08, 0x0F, 0x0D, // #@=      =@#      =@#
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+
+	/* @9244 'n' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x50, 0x15, 0x03, 0x30, //       --.    
+	0x1F, 0x05, 0x00, 0x08, 0x3F, 0x0D, 0x05, 0x10, // @@- =@@@@#-  
+	0x1F, 0x05, 0x0A, 0x6F, 0x03, 0x00, // @@-*@@@@@@@. 
+	0x1F, 0x0D, 0x0F, 0x0D, 0x03, 0x00, 0x02, 0x0A, 0x1F, 0x0C, 0x00, // @@#@#. .*@@# 
+	0x2F, 0x0A, 0x40, 0x0C, 0x1F, 0x02, // @@@*     #@@.
+	0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x05, // @@#      =@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x1F, 0x0A, 0x50, 0x05, 0x1F, 0x05, // @@*      -@@-
+	0x0D, 0x0F, 0x08, 0x50, 0x03, 0x1F, 0x03, // #@=      .@@.
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @9360 'o' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x40, 0x03, 0x25, 0x40, //      .---     
+	0x20, 0x07, 0x0D, 0x4F, 0x08, 0x02, 0x10, //    =#@@@@@=.  
+	0x10, 0x0C, 0x1F, 0x0D, 0x1A, 0x0D, 0x1F, 0x0D, 0x02, 0x00, //   #@@#**#@@#. 
+	0x00, 0x0A, 0x1F, 0x0A, 0x30, 0x0A, 0x1F, 0x0D, 0x00, //  *@@*    *@@# 
+	0x03, 0x1F, 0x0C, 0x50, 0x0C, 0x1F, 0x05, // .@@#      #@@-
+	0x08, 0x1F, 0x07, 0x50, 0x05, 0x1F, 0x0A, // =@@=      -@@*
+	0x0C, 0x1F, 0x02, 0x50, 0x02, 0x1F, 0x0D, // #@@.      .@@#
+	0x2F, 0x70, 0x2F, // @@@        @@@
+	0x2F, 0x70, 0x2F, // @@@        @@@
+	0x2F, 0x70, 0x2F, // @@@        @@@
+	0x0D, 0x1F, 0x03, 0x50, 0x03, 0x1F, 0x0C, // #@@.      .@@#
+	0x0A, 0x1F, 0x07, 0x50, 0x07, 0x1F, 0x08, // *@@=      =@@=
+	0x05, 0x1F, 0x0D, 0x02, 0x30, 0x02, 0x0D, 0x1F, 0x03, // -@@#.    .#@@.
+	0x00, 0x0D, 0x1F, 0x0D, 0x03, 0x10, 0x03, 0x0D, 0x1F, 0x0A, 0x00, //  #@@#.  .#@@* 
+	0x00, 0x02, 0x0D, 0x7F, 0x0A, 0x10, //  .#@@@@@@@@*  
+	0x10, 0x02, 0x08, 0x4F, 0x0D, 0x07, 0x20, //   .=@@@@@#=   
+	0x40, 0x25, 0x03, 0x40, //      ---.     
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @9484 'p' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x50, 0x15, 0x03, 0x30, //       --.    
+	0x1F, 0x05, 0x00, 0x08, 0x3F, 0x0D, 0x05, 0x10, // @@- =@@@@#-  
+	0x1F, 0x07, 0x0C, 0x6F, 0x05, 0x00, // @@=#@@@@@@@- 
+	0x3F, 0x0C, 0x03, 0x00, 0x02, 0x0A, 0x2F, 0x02, // @@@@#. .*@@@.
+	0x2F, 0x0A, 0x40, 0x0C, 0x1F, 0x07, // @@@*     #@@=
+	0x1F, 0x0C, 0x50, 0x05, 0x1F, 0x0A, // @@#      -@@*
+	0x1F, 0x0A, 0x50, 0x02, 0x2F, // @@*      .@@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x60, 0x2F, // @@*       @@@
+	0x1F, 0x0A, 0x50, 0x03, 0x1F, 0x0D, // @@*      .@@#
+	0x1F, 0x0C, 0x50, 0x07, 0x1F, 0x0A, // @@#      =@@*
+	0x2F, 0x0A, 0x40, 0x0D, 0x1F, 0x05, // @@@*     #@@-
+	0x3F, 0x0C, 0x03, 0x00, 0x02, 0x0C, 0x1F, 0x0D, 0x00, // @@@@#. .#@@# 
+	0x1F, 0x0C, 0x0D, 0x6F, 0x03, 0x00, // @@##@@@@@@@. 
+	0x1F, 0x0A, 0x02, 0x0A, 0x3F, 0x0C, 0x02, 0x10, // @@*.*@@@@#.  
+	0x1F, 0x0A, 0x10, 0x02, 0x15, 0x02, 0x30, // @@*  .--.    
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x1F, 0x0A, 0x90, // @@*          
+	0x08, 0x0A, 0x05, 0x90, // =*-          
+
+	/* @9611 'q' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x30, 0x02, 0x15, 0x02, 0x40, //     .--.     
+	0x10, 0x02, 0x0C, 0x3F, 0x0A, 0x02, 0x05, 0x1F, //   .#@@@@*.-@@
+	0x00, 0x03, 0x6F, 0x0D, 0x07, 0x1F, //  .@@@@@@@#=@@
+	0x00, 0x0D, 0x1F, 0x0A, 0x02, 0x00, 0x03, 0x0C, 0x3F, //  #@@*. .#@@@@
+	0x05, 0x1F, 0x0D, 0x40, 0x0A, 0x2F, // -@@#     *@@@
+	0x0A, 0x1F, 0x07, 0x50, 0x0C, 0x1F, // *@@=      #@@
+	0x0D, 0x1F, 0x03, 0x50, 0x0A, 0x1F, // #@@.      *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x60, 0x0A, 0x1F, // @@@       *@@
+	0x2F, 0x02, 0x50, 0x0A, 0x1F, // @@@.      *@@
+	0x0A, 0x1F, 0x07, 0x50, 0x0C, 0x1F, // *@@=      #@@
+	0x07, 0x1F, 0x0C, 0x40, 0x0A, 0x2F, // =@@#     *@@@
+	0x02, 0x2F, 0x0A, 0x02, 0x00, 0x03, 0x0C, 0x3F, // .@@@*. .#@@@@
+	0x00, 0x05, 0x6F, 0x1A, 0x1F, //  -@@@@@@@**@@
+	0x10, 0x05, 0x0D, 0x3F, 0x08, 0x00, 0x0A, 0x1F, //   -#@@@@= *@@
+	0x30, 0x03, 0x15, 0x20, 0x0A, 0x1F, //     .--   *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x0A, 0x1F, //           *@@
+	0x90, 0x05, 0x0A, 0x08, //           -*=
+
+	/* @9737 'r' (9 pixels wide) */
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x40, 0x03, 0x05, 0x03, 0x00, //      .-. 
+	0x1F, 0x05, 0x02, 0x0C, 0x2F, 0x05, // @@-.#@@@-
+	0x1F, 0x05, 0x0D, 0x3F, 0x05, // @@-#@@@@-
+	0x1F, 0x0D, 0x0F, 0x0A, 0x02, 0x00, 0x05, 0x02, // @@#@*. -.
+	0x2F, 0x0D, 0x40, // @@@#     
+	0x2F, 0x02, 0x40, // @@@.     
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x1F, 0x0A, 0x50, // @@*      
+	0x0D, 0x0F, 0x08, 0x50, // #@=      
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+
+	/* @9812 's' (10 pixels wide) */
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x30, 0x25, 0x20, //     ---   
+	0x00, 0x02, 0x08, 0x4F, 0x0C, 0x02, //  .=@@@@@#.
+	0x00, 0x0D, 0x1F, 0x0C, 0x1A, 0x1F, 0x05, //  #@@#**@@-
+	0x07, 0x1F, 0x07, 0x30, 0x07, 0x03, // =@@=    =.
+	0x0A, 0x1F, 0x60, // *@@       
+	0x0A, 0x1F, 0x02, 0x50, // *@@.      
+	0x05, 0x1F, 0x0D, 0x03, 0x40, // -@@#.     
+	0x00, 0x0A, 0x2F, 0x0C, 0x07, 0x20, //  *@@@#=   
+	0x10, 0x07, 0x3F, 0x0D, 0x05, 0x00, //   =@@@@#- 
+	0x30, 0x07, 0x0C, 0x2F, 0x05, //     =#@@@-
+	0x50, 0x07, 0x1F, 0x0C, //       =@@#
+	0x60, 0x0C, 0x1F, //        #@@
+	0x60, 0x0A, 0x1F, //        *@@
+	0x0F, 0x07, 0x30, 0x05, 0x1F, 0x0A, // @=    -@@*
+	0x2F, 0x1A, 0x0C, 0x1F, 0x0D, 0x02, // @@@**#@@#.
+	0x03, 0x0C, 0x4F, 0x0C, 0x02, 0x00, // .#@@@@@#. 
+	0x10, 0x02, 0x25, 0x30, //   .---    
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+
+	/* @9908 't' (9 pixels wide) */
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x10, 0x08, 0x0F, 0x0D, 0x30, //   =@#    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x0D, 0x7F, // #@@@@@@@@
+	0x0D, 0x6F, 0x0D, // #@@@@@@@#
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x30, //   *@@    
+	0x10, 0x0A, 0x1F, 0x02, 0x20, //   *@@.   
+	0x10, 0x07, 0x1F, 0x0A, 0x10, 0x05, //   =@@*  -
+	0x10, 0x02, 0x5F, //   .@@@@@@
+	0x20, 0x05, 0x3F, 0x0D, //    -@@@@#
+	0x40, 0x15, 0x03, 0x00, //      --. 
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+	0x80, //          
+
+	/* @9998 'u' (12 pixels wide) */
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0x0D, 0x0F, 0x08, 0x50, 0x08, 0x0F, 0x0D, // #@=      =@#
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, // @@*      *@@
+	0x1F, 0x0C, 0x50, 0x0C, 0x1F, // @@#      #@@
+	0x0C, 0x1F, 0x02, 0x30, 0x0A, 0x2F, // #@@.    *@@@
+	0x07, 0x1F, 0x0D, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x0D, 0x1F, // =@@#. .#@#@@
+	0x02, 0x0D, 0x5F, 0x0A, 0x05, 0x1F, // .#@@@@@@*-@@
+	0x00, 0x02, 0x0C, 0x3F, 0x08, 0x00, 0x05, 0x0F, 0x0D, //  .#@@@@= -@#
+	0x20, 0x03, 0x15, 0x50, //    .--      
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+	0xB0, //             
+
+	/* @10104 'v' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x1F, 0x08, 0x60, 0x03, 0x1F, 0x03, // @@=       .@@.
+	0x0D, 0x1F, 0x60, 0x0A, 0x1F, 0x00, // #@@       *@@ 
+	0x07, 0x1F, 0x05, 0x50, 0x1F, 0x0A, 0x00, // =@@-      @@* 
+	0x02, 0x1F, 0x0A, 0x40, 0x05, 0x1F, 0x03, 0x00, // .@@*     -@@. 
+	0x00, 0x0C, 0x1F, 0x40, 0x0C, 0x0F, 0x0D, 0x10, //  #@@     #@#  
+	0x00, 0x07, 0x1F, 0x05, 0x20, 0x02, 0x1F, 0x08, 0x10, //  =@@-   .@@=  
+	0x10, 0x1F, 0x0A, 0x20, 0x07, 0x1F, 0x03, 0x10, //   @@*   =@@.  
+	0x10, 0x0A, 0x1F, 0x20, 0x0C, 0x0F, 0x0D, 0x20, //   *@@   #@#   
+	0x10, 0x05, 0x1F, 0x05, 0x00, 0x02, 0x1F, 0x07, 0x20, //   -@@- .@@=   
+	0x20, 0x1F, 0x0C, 0x00, 0x07, 0x1F, 0x02, 0x20, //    @@# =@@.   
+	0x20, 0x08, 0x1F, 0x02, 0x0C, 0x0F, 0x0C, 0x30, //    =@@.#@#    
+	0x20, 0x03, 0x1F, 0x08, 0x1F, 0x07, 0x30, //    .@@=@@=    
+	0x30, 0x0D, 0x3F, 0x40, //     #@@@@     
+	0x30, 0x08, 0x2F, 0x0A, 0x40, //     =@@@*     
+	0x30, 0x02, 0x0D, 0x1F, 0x03, 0x40, //     .#@@.     
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+
+	/* @10226 'w' (21 pixels wide) */
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0x1F, 0x08, 0x50, 0x0D, 0x0F, 0x0A, 0x50, 0x08, 0x1F, // @@=      #@*      =@@
+	0x0D, 0x0F, 0x0C, 0x40, 0x02, 0x2F, 0x50, 0x0D, 0x0F, 0x0C, // #@#     .@@@      #@#
+	0x08, 0x1F, 0x02, 0x30, 0x07, 0x2F, 0x05, 0x30, 0x02, 0x1F, 0x07, // =@@.    =@@@-    .@@=
+	0x05, 0x1F, 0x07, 0x30, 0x0A, 0x2F, 0x08, 0x30, 0x07, 0x1F, 0x02, // -@@=    *@@@=    =@@.
+	0x00, 0x1F, 0x0A, 0x30, 0x1F, 0x0C, 0x0F, 0x0D, 0x30, 0x0A, 0x0F, 0x0D, 0x00, //  @@*    @@#@#    *@# 
+	0x00, 0x0A, 0x1F, 0x20, 0x03, 0x1F, 0x05, 0x1F, 0x02, 0x20, 0x1F, 0x08, 0x00, //  *@@   .@@-@@.   @@= 
+	0x00, 0x05, 0x1F, 0x05, 0x10, 0x07, 0x0F, 0x0A, 0x00, 0x1F, 0x07, 0x10, 0x05, 0x1F, 0x03, 0x00, //  -@@-  =@* @@=  -@@. 
+	0x10, 0x1F, 0x08, 0x10, 0x0C, 0x0F, 0x05, 0x00, 0x0A, 0x0F, 0x0A, 0x10, 0x08, 0x0F, 0x0D, 0x10, //   @@=  #@- *@*  =@#  
+	0x10, 0x0C, 0x0F, 0x0D, 0x10, 0x1F, 0x02, 0x00, 0x07, 0x1F, 0x10, 0x0D, 0x0F, 0x08, 0x10, //   #@#  @@. =@@  #@=  
+	0x10, 0x07, 0x1F, 0x02, 0x05, 0x0F, 0x0D, 0x10, 0x02, 0x1F, 0x05, 0x02, 0x1F, 0x05, 0x10, //   =@@.-@#  .@@-.@@-  
+	0x10, 0x02, 0x1F, 0x07, 0x08, 0x0F, 0x0A, 0x20, 0x0D, 0x0F, 0x08, 0x07, 0x1F, 0x20, //   .@@==@*   #@==@@   
+	0x20, 0x0C, 0x0F, 0x0A, 0x0C, 0x0F, 0x05, 0x20, 0x08, 0x0F, 0x0D, 0x0A, 0x0F, 0x0A, 0x20, //    #@*#@-   =@#*@*   
+	0x20, 0x08, 0x3F, 0x02, 0x20, 0x05, 0x3F, 0x05, 0x20, //    =@@@@.   -@@@@-   
+	0x20, 0x03, 0x2F, 0x0C, 0x40, 0x3F, 0x30, //    .@@@#     @@@@    
+	0x30, 0x0D, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x0A, 0x30, //     #@@=     =@@*    
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+	0xF0, 0x40, //                      
+
+	/* @10439 'x' (13 pixels wide) */
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0x0C, 0x0F, 0x0D, 0x02, 0x40, 0x08, 0x1F, 0x00, // #@#.     =@@ 
+	0x05, 0x1F, 0x0A, 0x30, 0x03, 0x1F, 0x08, 0x00, // -@@*    .@@= 
+	0x00, 0x0C, 0x1F, 0x03, 0x20, 0x0D, 0x0F, 0x0D, 0x10, //  #@@.   #@#  
+	0x00, 0x02, 0x1F, 0x0D, 0x10, 0x07, 0x1F, 0x03, 0x10, //  .@@#  =@@.  
+	0x10, 0x07, 0x1F, 0x08, 0x02, 0x1F, 0x0A, 0x20, //   =@@=.@@*   
+	0x20, 0x0D, 0x1F, 0x0C, 0x0F, 0x0D, 0x02, 0x20, //    #@@#@#.   
+	0x20, 0x03, 0x3F, 0x07, 0x30, //    .@@@@=    
+	0x30, 0x0C, 0x2F, 0x02, 0x30, //     #@@@.    
+	0x20, 0x05, 0x3F, 0x0A, 0x30, //    -@@@@*    
+	0x10, 0x02, 0x0D, 0x0F, 0x1A, 0x1F, 0x03, 0x20, //   .#@**@@.   
+	0x10, 0x0A, 0x1F, 0x12, 0x1F, 0x0D, 0x20, //   *@@..@@#   
+	0x00, 0x05, 0x1F, 0x07, 0x10, 0x07, 0x1F, 0x08, 0x10, //  -@@=  =@@=  
+	0x00, 0x0D, 0x0F, 0x0D, 0x30, 0x0D, 0x1F, 0x02, 0x00, //  #@#    #@@. 
+	0x08, 0x1F, 0x03, 0x30, 0x03, 0x1F, 0x0C, 0x00, // =@@.    .@@# 
+	0x1F, 0x0A, 0x50, 0x0A, 0x1F, 0x05, // @@*      *@@-
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+	0xC0, //              
+
+	/* @10566 'y' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x1F, 0x08, 0x60, 0x03, 0x1F, 0x03, // @@=       .@@.
+	0x0C, 0x1F, 0x60, 0x0A, 0x1F, 0x00, // #@@       *@@ 
+	0x07, 0x1F, 0x05, 0x50, 0x1F, 0x0A, 0x00, // =@@-      @@* 
+	0x02, 0x1F, 0x0A, 0x40, 0x07, 0x1F, 0x03, 0x00, // .@@*     =@@. 
+	0x00, 0x0C, 0x1F, 0x02, 0x30, 0x0C, 0x0F, 0x0D, 0x10, //  #@@.    #@#  
+	0x00, 0x05, 0x1F, 0x07, 0x20, 0x02, 0x1F, 0x08, 0x10, //  -@@=   .@@=  
+	0x10, 0x1F, 0x0C, 0x20, 0x07, 0x1F, 0x03, 0x10, //   @@#   =@@.  
+	0x10, 0x08, 0x1F, 0x02, 0x10, 0x0C, 0x0F, 0x0C, 0x20, //   =@@.  #@#   
+	0x10, 0x03, 0x1F, 0x07, 0x00, 0x02, 0x1F, 0x07, 0x20, //   .@@= .@@=   
+	0x20, 0x0D, 0x0F, 0x0C, 0x00, 0x07, 0x1F, 0x02, 0x20, //    #@# =@@.   
+	0x20, 0x07, 0x1F, 0x03, 0x0C, 0x0F, 0x0C, 0x30, //    =@@.#@#    
+	0x20, 0x02, 0x1F, 0x0A, 0x1F, 0x07, 0x30, //    .@@*@@=    
+	0x30, 0x0C, 0x3F, 0x40, //     #@@@@     
+	0x30, 0x05, 0x2F, 0x0A, 0x40, //     -@@@*     
+	0x40, 0x0D, 0x1F, 0x05, 0x40, //      #@@-     
+	0x40, 0x0C, 0x0F, 0x0D, 0x50, //      #@#      
+	0x30, 0x02, 0x1F, 0x08, 0x50, //     .@@=      
+	0x30, 0x08, 0x1F, 0x03, 0x50, //     =@@.      
+	0x30, 0x0D, 0x0F, 0x0D, 0x60, //     #@#       
+	0x20, 0x05, 0x1F, 0x07, 0x60, //    -@@=       
+	0x20, 0x05, 0x1A, 0x02, 0x60, //    -**.       
+
+	/* @10714 'z' (10 pixels wide) */
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x0A, 0x7F, 0x08, // *@@@@@@@@=
+	0x0A, 0x7F, 0x0A, // *@@@@@@@@*
+	0x03, 0x45, 0x0A, 0x1F, 0x05, // .-----*@@-
+	0x40, 0x02, 0x0D, 0x0F, 0x0C, 0x00, //      .#@# 
+	0x40, 0x0A, 0x1F, 0x02, 0x00, //      *@@. 
+	0x30, 0x05, 0x1F, 0x08, 0x10, //     -@@=  
+	0x20, 0x02, 0x0D, 0x0F, 0x0D, 0x20, //    .#@#   
+	0x20, 0x08, 0x1F, 0x03, 0x20, //    =@@.   
+	0x10, 0x03, 0x1F, 0x08, 0x30, //   .@@=    
+	0x10, 0x0D, 0x0F, 0x0D, 0x40, //   #@#     
+	0x00, 0x08, 0x1F, 0x03, 0x40, //  =@@.     
+	0x03, 0x1F, 0x08, 0x50, // .@@=      
+	0x0C, 0x1F, 0x55, 0x03, // #@@------.
+	0x9F, // @@@@@@@@@@
+	0x0D, 0x7F, 0x0D, // #@@@@@@@@#
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+	0x90, //           
+
+	/* @10794 '{' (8 pixels wide) */
+	0x70, //         
+	0x70, //         
+	0x30, 0x08, 0x1F, 0x08, //     =@@=
+	0x20, 0x08, 0x2F, 0x0A, //    =@@@*
+	0x20, 0x1F, 0x0A, 0x10, //    @@*  
+	0x20, 0x1F, 0x05, 0x10, //    @@-  
+	0x10, 0x05, 0x1F, 0x03, 0x10, //   -@@.  
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x08, 0x0F, 0x0D, 0x20, //   =@#   
+	0x00, 0x05, 0x1F, 0x07, 0x20, //  -@@=   
+	0x2F, 0x08, 0x30, // @@@=    
+	0x0D, 0x1F, 0x08, 0x30, // #@@=    
+	0x00, 0x05, 0x1F, 0x07, 0x20, //  -@@=   
+	0x10, 0x08, 0x0F, 0x0D, 0x20, //   =@#   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x03, 0x10, //   -@@.  
+	0x20, 0x1F, 0x05, 0x10, //    @@-  
+	0x20, 0x1F, 0x0A, 0x10, //    @@*  
+	0x20, 0x08, 0x2F, 0x0A, //    =@@@*
+	0x30, 0x08, 0x1F, 0x08, //     =@@=
+	0x70, //         
+
+	/* @10910 '|' (3 pixels wide) */
+	0x20, //    
+	0x03, 0x05, 0x02, // .-.
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x1F, 0x0A, // @@*
+	0x08, 0x0A, 0x05, // =*-
+
+	/* @10971 '}' (8 pixels wide) */
+	0x70, //         
+	0x70, //         
+	0x0A, 0x1F, 0x08, 0x30, // *@@=    
+	0x0C, 0x2F, 0x08, 0x20, // #@@@=   
+	0x10, 0x0A, 0x0F, 0x0D, 0x20, //   *@#   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x03, 0x10, //   -@@.  
+	0x20, 0x1F, 0x05, 0x10, //    @@-  
+	0x20, 0x0C, 0x0F, 0x0D, 0x03, 0x00, //    #@#. 
+	0x20, 0x02, 0x08, 0x1F, 0x0D, //    .=@@#
+	0x30, 0x08, 0x1F, 0x0D, //     =@@#
+	0x20, 0x05, 0x1F, 0x05, 0x00, //    -@@- 
+	0x20, 0x0C, 0x0F, 0x0A, 0x10, //    #@*  
+	0x20, 0x1F, 0x05, 0x10, //    @@-  
+	0x10, 0x03, 0x1F, 0x05, 0x10, //   .@@-  
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x05, 0x1F, 0x20, //   -@@   
+	0x10, 0x0A, 0x0F, 0x0D, 0x20, //   *@#   
+	0x0C, 0x2F, 0x08, 0x20, // #@@@=   
+	0x0A, 0x1F, 0x08, 0x30, // *@@=    
+	0x70, //         
+
+	/* @11091 '~' (14 pixels wide) */
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0x00, 0x02, 0x07, 0x1A, 0x05, 0x40, 0x02, 0x15, //  .=**-     .--
+	0x02, 0x0D, 0x3F, 0x0A, 0x30, 0x05, 0x1F, // .#@@@@*    -@@
+	0x08, 0x1F, 0x07, 0x05, 0x0C, 0x0F, 0x0A, 0x20, 0x07, 0x1F, // =@@=-#@*   =@@
+	0x1F, 0x08, 0x20, 0x0D, 0x0F, 0x07, 0x00, 0x02, 0x0D, 0x0F, 0x0A, // @@=   #@= .#@*
+	0x1F, 0x05, 0x20, 0x02, 0x0D, 0x3F, 0x0D, 0x02, // @@-   .#@@@@#.
+	0x15, 0x02, 0x30, 0x02, 0x0A, 0x1F, 0x0C, 0x02, 0x00, // --.    .*@@#. 
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+	0xD0, //               
+};
+
+/**
+ * @brief 30 pixels height anti-aliased (4 bpp) char info array. 
+ */
+const aa_char_info_t font_aa_30_info[] = {
+	{1, 0}, 		/*   */ 
+	{4, 30}, 		/* ! */ 
+	{8, 106}, 		/* " */ 
+	{15, 176}, 		/* # */ 
+	{13, 341}, 		/* $ */ 
+	{21, 496}, 		/* % */ 
+	{19, 766}, 		/* & */ 
+	{3, 992}, 		/* \' */ 
+	{6, 1033}, 		/* ( */ 
+	{6, 1149}, 		/* ) */ 
+	{11, 1265}, 		/* * */ 
+	{14, 1375}, 		/* + */ 
+	{5, 1452}, 		/* , */ 
+	{8, 1505}, 		/* - */ 
+	{4, 1540}, 		/* . */ 
+	{12, 1578}, 		/* / */ 
+	{15, 1707}, 		/* 0 */ 
+	{13, 1861}, 		/* 1 */ 
+	{13, 1945}, 		/* 2 */ 
+	{13, 2067}, 		/* 3 */ 
+	{15, 2208}, 		/* 4 */ 
+	{13, 2357}, 		/* 5 */ 
+	{14, 2462}, 		/* 6 */ 
+	{14, 2608}, 		/* 7 */ 
+	{14, 2712}, 		/* 8 */ 
+	{14, 2888}, 		/* 9 */ 
+	{4, 3038}, 		/* : */ 
+	{5, 3084}, 		/* ; */ 
+	{14, 3150}, 		/* < */ 
+	{13, 3255}, 		/* = */ 
+	{14, 3293}, 		/* > */ 
+	{12, 3391}, 		/* ? */ 
+	{24, 3510}, 		/* @ */ 
+	{18, 3822}, 		/* A */ 
+	{14, 3991}, 		/* B */ 
+	{15, 4108}, 		/* C */ 
+	{16, 4234}, 		/* D */ 
+	{12, 4357}, 		/* E */ 
+	{11, 4414}, 		/* F */ 
+	{17, 4469}, 		/* G */ 
+	{15, 4626}, 		/* H */ 
+	{3, 4740}, 		/* I */ 
+	{8, 4774}, 		/* J */ 
+	{14, 4840}, 		/* K */ 
+	{11, 4982}, 		/* L */ 
+	{22, 5037}, 		/* M */ 
+	{16, 5246}, 		/* N */ 
+	{18, 5414}, 		/* O */ 
+	{13, 5584}, 		/* P */ 
+	{21, 5674}, 		/* Q */ 
+	{14, 5870}, 		/* R */ 
+	{13, 5997}, 		/* S */ 
+	{16, 6129}, 		/* T */ 
+	{16, 6236}, 		/* U */ 
+	{17, 6374}, 		/* V */ 
+	{27, 6548}, 		/* W */ 
+	{15, 6842}, 		/* X */ 
+	{15, 7014}, 		/* Y */ 
+	{14, 7148}, 		/* Z */ 
+	{6, 7255}, 		/* [ */ 
+	{12, 7337}, 		/* \\ */ 
+	{6, 7465}, 		/* ] */ 
+	{13, 7549}, 		/* ^ */ 
+	{16, 7657}, 		/* _ */ 
+	{5, 7691}, 		/* ` */ 
+	{12, 7737}, 		/* a */ 
+	{13, 7854}, 		/* b */ 
+	{11, 7982}, 		/* c */ 
+	{13, 8076}, 		/* d */ 
+	{13, 8205}, 		/* e */ 
+	{10, 8307}, 		/* f */ 
+	{14, 8408}, 		/* g */ 
+	{13, 8573}, 		/* h */ 
+	{4, 8701}, 		/* i */ 
+	{7, 8772}, 		/* j */ 
+	{12, 8880}, 		/* k */ 
+	{3, 9010}, 		/* l */ 
+	{21, 9064}, 		/* m */ 
+	{13, 9244}, 		/* n */ 
+	{14, 9360}, 		/* o */ 
+	{13, 9484}, 		/* p */ 
+	{13, 9611}, 		/* q */ 
+	{9, 9737}, 		/* r */ 
+	{10, 9812}, 		/* s */ 
+	{9, 9908}, 		/* t */ 
+	{12, 9998}, 		/* u */ 
+	{14, 10104}, 		/* v */ 
+	{21, 10226}, 		/* w */ 
+	{13, 10439}, 		/* x */ 
+	{14, 10566}, 		/* y */ 
+	{10, 10714}, 		/* z */ 
+	{8, 10794}, 		/* { */ 
+	{3, 10910}, 		/* | */ 
+	{8, 10971}, 		/* } */ 
+	{14, 11091}, 		/* ~ */ 
+};
+
 /*==================[external data definition]===============================*/
 
 Font_t font_11 = {
@@ -23686,6 +26834,15 @@ Font_t font_89 = {
 	font89_data
 };
 
+AAFont_t font_aa_30 = {
+	30,
+	4,
+	' ',
+	'~',
+	font_aa_30_info,
+	font_aa_30_data
+};
+
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
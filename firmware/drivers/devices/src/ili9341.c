@@ -11,10 +11,19 @@
 
 /*==================[inclusions]=============================================*/
 #include "ili9341.h"
+#include <string.h>
+#include <stdbool.h>
 #include "fonts.h"
 #include "spi_mcu.h"
+#include "dma_pool_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -22,11 +31,29 @@
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
-#define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define DMA_BUFFER_SIZE SPI_MAX_TRANSFER_SIZE	/*!< Size of each pixel streaming buffer (one full DMA transaction) */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
 #define UP -1						/*!< Vertical grow direction */
+#define DC_CMD (void*)0				/*!< Transaction tag: DC low, command byte */
+#define DC_DATA (void*)1			/*!< Transaction tag: DC high, parameters or data */
+#define FB_DIRTY_MAX 8				/*!< Maximum number of dirty rectangles tracked by the framebuffer */
+#define GLYPH_GAP 1					/*!< Blank columns between characters of a string */
+#define INT_MAX_DIGITS 10			/*!< Maximum number of digits of an uint32_t */
+#define GLYPH_CACHE_SLOTS 32		/*!< Maximum number of glyphs in the cache */
+#define TEXT_LINE_MAX 64			/*!< Maximum number of cached glyphs in a line of text */
+#define CONSOLE_LINE_MAX 128		/*!< Maximum number of characters in a line of the console */
+#define FONT_FIRST ' '				/*!< First character of the fonts */
+#define FONT_LAST '~'				/*!< Last character of the fonts */
+#define RENDER_TASK_STACK 4096		/*!< Stack size of the render task (bytes) */
+#define IMG_TAG_MASK 0xC0			/*!< Compressed image: chunk tag bits */
+#define IMG_INDEX 0x00				/*!< Compressed image: pixel from the table of recent pixels */
+#define IMG_RUN 0x40				/*!< Compressed image: previous pixel repeated */
+#define IMG_DIFF 0x80				/*!< Compressed image: small difference from previous pixel */
+#define IMG_LITERAL 0xC0			/*!< Compressed image: raw pixels */
+#define IMG_VALUE_MASK 0x3F			/*!< Compressed image: chunk value bits */
+#define ImageHash(p) ((((p) >> 11) * 3 + (((p) >> 5) & 0x3F) * 5 + ((p) & 0x1F) * 7) & 0x3F)	/*!< Position of a pixel in the table of recent pixels */
 
 /* Command List */
 #define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
@@ -40,7 +67,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Defines the vertical scrolling area of the display */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_ADDR	0x37 	/*!< Line in frame memory written as first line of the vertical scrolling area */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -64,6 +93,7 @@
 
 #define HighByte(x) x >> 8			/*!< High byte of a 16 bits data */
 #define LowByte(x) x & 0xFF			/*!< Low byte of a 16 bits data */
+#define WireOrder(x) (uint16_t)((x) << 8 | (x) >> 8)	/*!< 16 bits data with the high byte first in memory */
 /*==================[typedef]================================================*/
 /**
  * @brief  Structure with LCD orientation properties
@@ -74,6 +104,110 @@ typedef struct {
 	ili9341_orientation_t orientation;	/*!< LCD Orientation */
 } orientation_properties_t;
 
+/**
+ * @brief  Rectangular area of the LCD (corners included)
+ */
+typedef struct {
+	uint16_t x0;						/*!< Start column */
+	uint16_t y0;						/*!< Start row */
+	uint16_t x1;						/*!< End column */
+	uint16_t y1;						/*!< End row */
+} rect_t;
+
+/**
+ * @brief  Off-screen copy of an area of the LCD
+ */
+typedef struct {
+	uint16_t *data;						/*!< Pixels, stored in wire order (NULL when framebuffer is disabled) */
+	rect_t area;						/*!< Area of the LCD covered by the framebuffer */
+	uint16_t width;						/*!< Framebuffer width in pixels */
+	rect_t dirty[FB_DIRTY_MAX];			/*!< Areas modified since last flush */
+	uint8_t dirty_count;				/*!< Number of dirty areas */
+} framebuffer_t;
+
+/**
+ * @brief  Address window being written by a drawing primitive
+ */
+typedef struct {
+	rect_t area;						/*!< Window area */
+	uint16_t x;							/*!< Column of next pixel */
+	uint16_t y;							/*!< Row of next pixel */
+	bool to_panel;						/*!< Pixels are streamed to the LCD */
+	bool to_fb;							/*!< Pixels are stored in the framebuffer */
+} window_t;
+
+/**
+ * @brief  Pre-rendered glyph (RGB565, wire order)
+ */
+typedef struct {
+	const Font_t *font;					/*!< Font */
+	char data;							/*!< Character */
+	uint16_t foreground;				/*!< Foreground color */
+	uint16_t background;				/*!< Background color */
+	uint16_t *pixels;					/*!< Glyph pixels, row by row (NULL: free slot) */
+	uint32_t size;						/*!< Size of pixels in bytes */
+	uint32_t last_use;					/*!< Line of text where the glyph was last used */
+} glyph_t;
+
+/**
+ * @brief  LRU cache of pre-rendered glyphs
+ */
+typedef struct {
+	glyph_t glyph[GLYPH_CACHE_SLOTS];	/*!< Cached glyphs */
+	uint32_t budget;					/*!< Maximum memory for glyph pixels in bytes (0: cache disabled) */
+	uint32_t used;						/*!< Memory used by glyph pixels in bytes */
+	uint32_t tick;						/*!< Lines of text drawn, used as LRU clock */
+} glyph_cache_t;
+
+/**
+ * @brief  Vertical scrolling area, in frame memory lines (the 320 pixels side of the panel)
+ */
+typedef struct {
+	bool enabled;						/*!< Scrolling area defined */
+	bool reversed;						/*!< Memory lines grow opposite to the LCD coordinates (MY = 1) */
+	uint16_t first;						/*!< First memory line of the area */
+	uint16_t lines;						/*!< Number of lines of the area */
+	uint16_t pos;						/*!< Memory line shown as first line of the area */
+} scroll_t;
+
+/**
+ * @brief  Text console on the scrolling area
+ */
+typedef struct {
+	Font_t *font;						/*!< Font */
+	uint16_t foreground;				/*!< Text color */
+	uint16_t background;				/*!< Background color */
+} console_t;
+
+/**
+ * @brief  Commands of the render task
+ */
+typedef enum {
+	RENDER_FILL,						/*!< Filled rectangle */
+	RENDER_LINE,						/*!< Line */
+	RENDER_STRING,						/*!< String */
+	RENDER_INT,							/*!< Integer */
+	RENDER_STRIP,						/*!< Strip plot sample */
+	RENDER_CONSOLE,						/*!< Console text */
+	RENDER_FLUSH,						/*!< Framebuffer flush */
+	RENDER_FENCE,						/*!< Signal when every previous command is done */
+} render_id_t;
+
+/**
+ * @brief  Draw command posted to the render task
+ */
+typedef struct {
+	render_id_t id;						/*!< Command */
+	rect_t area;						/*!< Rectangle, line end points or text position (x0, y0) */
+	uint16_t foreground;				/*!< Color or text color */
+	uint16_t background;				/*!< Text background color */
+	int32_t value;						/*!< Integer or strip plot sample */
+	uint8_t digits;						/*!< Number of digits of the integer */
+	Font_t *font;						/*!< Text font */
+	SemaphoreHandle_t fence;			/*!< Semaphore given by a fence */
+	char text[ILI9341_ASYNC_TEXT_MAX];	/*!< Copy of the text */
+} render_cmd_t;
+
 /**
  * @brief Structure to configure or write LCD
  */
@@ -87,7 +221,16 @@ typedef struct {
 /*==================[internal functions declaration]=========================*/
 
 /**
- * @brief  		Send command and parameters/data to LCD
+ * @brief  		Set DC pin before each SPI transaction starts
+ * @param[in]  	dc: Transaction tag (DC_CMD or DC_DATA)
+ * @retval 		None
+ */
+void SetDC(void * dc);
+
+/**
+ * @brief  		Queue command and parameters/data to LCD
+ * @note		Transfers are not finished when this function returns, call
+ * 				SpiWaitQueue() before modifying the data buffer.
  * @param[in]  	data: Structure with the command and parameters/data to send
  * @retval 		None
  */
@@ -114,6 +257,281 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Fill an area of LCD memory with a determined color (without framebuffer)
+ * @param[in]  	x1: Start column
+ * @param[in]  	y1: Start row
+ * @param[in]  	x2: End column
+ * @param[in]  	y2: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void FillPanel(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Start a pixel stream on the buffer that is not on the wire
+ * @retval 		None
+ */
+void StreamStart(void);
+
+/**
+ * @brief  		Queue the current stream buffer and swap to the other one
+ * @note		Waits only until the other buffer has left the wire, so the CPU
+ * 				fills the next buffer while the previous one is being transmitted.
+ * @retval 		None
+ */
+void StreamSend(void);
+
+/**
+ * @brief  		Add one pixel to the current pixel stream
+ * @param[in]	color: color (RGB565)
+ * @retval 		None
+ */
+static inline void StreamPixel(uint16_t color);
+
+/**
+ * @brief  		Adds a run of pixels, already in wire order, to the pixel stream
+ * @param[in]	pixels: Pixels (high byte first)
+ * @param[in]	n: Number of pixels
+ * @retval 		None
+ */
+static inline void StreamPixels(const uint16_t *pixels, uint16_t n);
+
+/**
+ * @brief  		Adds a run of pixels of the same color, already in wire order, to the pixel stream
+ * @param[in]	pixel: Pixel (high byte first)
+ * @param[in]	n: Number of pixels
+ * @retval 		None
+ */
+static inline void StreamRun(uint16_t pixel, uint16_t n);
+
+/**
+ * @brief  		Send the rest of the pixel stream and wait for the transfer to end
+ * @retval 		None
+ */
+void StreamEnd(void);
+
+/**
+ * @brief  		Intersection of two areas
+ * @param[in]  	a: First area
+ * @param[in]  	b: Second area
+ * @param[out]  out: Intersection area
+ * @retval 		true if areas intersect
+ */
+bool RectIntersect(const rect_t *a, const rect_t *b, rect_t *out);
+
+/**
+ * @brief  		Smallest area containing two areas
+ * @param[in]  	a: First area
+ * @param[in]  	b: Second area
+ * @retval 		Union area
+ */
+rect_t RectUnion(const rect_t *a, const rect_t *b);
+
+/**
+ * @brief  		Number of pixels of an area
+ * @param[in]  	r: Area
+ * @retval 		Number of pixels
+ */
+uint32_t RectArea(const rect_t *r);
+
+/**
+ * @brief  		Add an area to the framebuffer dirty list, merging it with others when convenient
+ * @param[in]  	r: Modified area
+ * @retval 		None
+ */
+void FramebufferMark(const rect_t *r);
+
+/**
+ * @brief  		Fill an area of the framebuffer with a determined color
+ * @param[in]  	r: Area (must be inside the framebuffer)
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void FramebufferFill(const rect_t *r, uint16_t color);
+
+/**
+ * @brief  		Updates the font byte to pixels lookup table for the given colors
+ * @param[in]	foreground: Color of the set bits
+ * @param[in]	background: Color of the cleared bits
+ * @retval 		None
+ */
+void GlyphLutUpdate(uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Gets a character rendered with the colors of the lookup table from the glyph cache,
+ * 				rendering it if missing
+ * @note		Glyphs used by the line of text being drawn are never evicted.
+ * @param[in]  	font: Font
+ * @param[in]  	data: Character
+ * @retval 		Glyph pixels, NULL when cache is disabled or glyph doesn't fit
+ */
+const uint16_t * GlyphCacheGet(Font_t *font, char data);
+
+/**
+ * @brief  		Width in pixels of a run of characters
+ * @param[in]  	str: Characters
+ * @param[in]  	len: Number of characters
+ * @param[in]  	font: Font
+ * @param[in]  	gap: Blank columns between characters
+ * @param[in]  	cell: Width of every character (0: each character takes its own width)
+ * @retval 		Width in pixels
+ */
+uint16_t TextWidth(const char *str, uint16_t len, Font_t *font, uint8_t gap, uint8_t cell);
+
+/**
+ * @brief  		Draws a run of characters on a single address window, with the colors of the lookup table
+ * @param[in]  	x: X start point
+ * @param[in]  	y: Y start point
+ * @param[in]  	str: Characters
+ * @param[in]  	len: Number of characters
+ * @param[in]  	font: Font
+ * @param[in]  	gap: Blank columns (background color) between characters
+ * @param[in]  	cell: Width of every character, padded with background (0: each character takes its own width)
+ * @retval 		None
+ */
+void TextLine(uint16_t x, uint16_t y, const char *str, uint16_t len, Font_t *font, uint8_t gap, uint8_t cell);
+
+/**
+ * @brief  		Updates the anti-aliased font intensity to color lookup table
+ * @param[in]	foreground: Color of the maximum intensity
+ * @param[in]	background: Color of intensity 0
+ * @param[in]	bpp: Bits per pixel of the font
+ * @retval 		None
+ */
+void AALutUpdate(uint16_t foreground, uint16_t background, uint8_t bpp);
+
+/**
+ * @brief  		Information of a character of an anti-aliased font
+ * @note		Characters out of the font range get the first character of the font.
+ * @param[in]  	font: Font
+ * @param[in]  	data: Character
+ * @retval 		Character information
+ */
+const aa_char_info_t * AAInfo(AAFont_t *font, char data);
+
+/**
+ * @brief  		Width in pixels of a run of characters of an anti-aliased font
+ * @param[in]  	str: Characters
+ * @param[in]  	len: Number of characters
+ * @param[in]  	font: Font
+ * @param[in]  	gap: Blank columns between characters
+ * @retval 		Width in pixels
+ */
+uint16_t TextWidthAA(const char *str, uint16_t len, AAFont_t *font, uint8_t gap);
+
+/**
+ * @brief  		Draws a run of characters of an anti-aliased font on a single address window,
+ * 				with the colors of the lookup table
+ * @param[in]  	x: X start point
+ * @param[in]  	y: Y start point
+ * @param[in]  	str: Characters
+ * @param[in]  	len: Number of characters (TEXT_LINE_MAX max)
+ * @param[in]  	font: Font
+ * @param[in]  	gap: Blank columns (background color) between characters
+ * @retval 		None
+ */
+void TextLineAA(uint16_t x, uint16_t y, const char *str, uint16_t len, AAFont_t *font, uint8_t gap);
+
+/**
+ * @brief  		Draw a horizontal or vertical span (or any filled box) clipped to the LCD
+ * @param[in]  	x0: Start column (may be outside the LCD)
+ * @param[in]  	y0: Start row (may be outside the LCD)
+ * @param[in]  	x1: End column (may be outside the LCD)
+ * @param[in]  	y1: End row (may be outside the LCD)
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw the 8 symmetric spans of a circle outline for a run of octant points
+ * @param[in]  	x0: X coordinate of center circle point
+ * @param[in]  	y0: Y coordinate of center circle point
+ * @param[in]  	xa: First x offset of the run
+ * @param[in]  	xb: Last x offset of the run
+ * @param[in]  	y: Y offset of the run
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void CircleSpans(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Line of the LCD (row in portrait, column in landscape) where the next lines
+ * 				of the scrolling area must be drawn
+ * @note		Those are the lines that will scroll out of the area, shown at the start of it.
+ * @param[in]  	n: Number of lines to draw
+ * @retval 		Smallest LCD coordinate of the lines
+ */
+uint16_t ScrollNext(uint16_t n);
+
+/**
+ * @brief  		Scrolls the area, the first n lines are moved to the end of it
+ * @param[in]  	n: Number of lines
+ * @retval 		None
+ */
+void ScrollLines(uint16_t n);
+
+/**
+ * @brief  		Render task: draws the commands posted by the ILI9341Async functions
+ * @param[in]  	param: Not used
+ * @retval 		None
+ */
+void RenderTask(void *param);
+
+/**
+ * @brief  		Posts a command to the render task, waits if the queue is full
+ * @param[in]  	cmd: Command
+ * @retval 		None
+ */
+void RenderPost(render_cmd_t *cmd);
+
+/**
+ * @brief  		Open an address window: pixels will go to the LCD, the framebuffer or both
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @retval 		None
+ */
+void WindowStart(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief  		Write next pixel of the address window (row by row)
+ * @param[in]	color: color
+ * @retval 		None
+ */
+static inline void WindowPixel(uint16_t color);
+
+/**
+ * @brief  		Writes a run of pixels, already in wire order, to the address window
+ * @param[in]	pixels: Pixels (high byte first)
+ * @param[in]	n: Number of pixels
+ * @retval 		None
+ */
+static inline void WindowPixels(const uint16_t *pixels, uint16_t n);
+
+/**
+ * @brief  		Writes a run of pixels of the same color, already in wire order, to the address window
+ * @param[in]	pixel: Pixel (high byte first)
+ * @param[in]	n: Number of pixels
+ * @retval 		None
+ */
+static inline void WindowRun(uint16_t pixel, uint16_t n);
+
+/**
+ * @brief  		Writes a pixel, already in wire order, to the framebuffer part of the window
+ * @param[in]	pixel: Pixel (high byte first)
+ * @retval 		None
+ */
+static inline void WindowFbPixel(uint16_t pixel);
+
+/**
+ * @brief  		Close the address window
+ * @retval 		None
+ */
+void WindowEnd(void);
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -180,11 +598,37 @@ spi_mcu_config_t spi_conf = {
 	.bitrate = SPI_BR, 
 	.transfer_mode = SPI_POLLING, 
 	.func_p = NULL,
-	.param_p = NULL };
+	.param_p = NULL,
+	.pre_func_p = NULL };
 
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
+static uint8_t *stream_buffer[2];			/*!< Double buffer for pixel streaming, lent by the DMA pool */
+static uint8_t stream_index;				/*!< Buffer being filled by the CPU */
+static uint32_t stream_bytes;				/*!< Bytes already written on the buffer being filled */
+static framebuffer_t framebuffer;			/*!< Off-screen framebuffer (disabled by default) */
+static window_t window;						/*!< Address window being written */
+static ili9341_stats_t lcd_stats;			/*!< SPI traffic counters */
+static uint16_t glyph_lut[256][8];			/*!< Font byte to 8 pixels expansion, in wire order */
+static uint16_t glyph_fg, glyph_bg;			/*!< Colors of the lookup table */
+static bool glyph_lut_valid = false;		/*!< Lookup table was built */
+static glyph_cache_t glyph_cache;			/*!< Pre-rendered glyphs (disabled by default) */
+static const uint16_t *line_glyphs[TEXT_LINE_MAX];	/*!< Cached glyphs of the line of text being drawn */
+static uint16_t aa_lut[16];					/*!< Anti-aliased font intensity to color, in wire order */
+static uint16_t aa_fg, aa_bg;				/*!< Colors of the anti-aliased lookup table */
+static uint8_t aa_bpp = 0;					/*!< Bits per pixel of the anti-aliased lookup table (0: not built) */
+static const uint8_t *aa_rows[TEXT_LINE_MAX];	/*!< Next run of each character of the line of text being drawn */
+static uint8_t aa_widths[TEXT_LINE_MAX];	/*!< Width of each character of the line of text being drawn */
+
+static scroll_t scroll;						/*!< Vertical scrolling area (disabled by default) */
+static ili9341_strip_t strip;				/*!< Strip plot configuration */
+static uint16_t strip_last;					/*!< Position of last sample of the strip plot (0xFFFF: none) */
+static console_t console;					/*!< Text console configuration */
+
+static QueueHandle_t render_queue = NULL;	/*!< Commands for the render task (async mode disabled if NULL) */
+static TaskHandle_t render_task = NULL;		/*!< Render task */
+
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
 		ILI9341_HEIGHT,
@@ -193,19 +637,24 @@ static orientation_properties_t lcd_orientation = {
 
 /*==================[internal functions definition]==========================*/
 
+void IRAM_ATTR SetDC(void * dc){
+	GPIOState(ili9341_dc, dc == DC_DATA);
+}
+
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
-		/* Send command */
-		GPIOOff(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+		/* Queue command */
+		SpiQueueWrite(ili9341_spi, &data->cmd, 1, DC_CMD);
+		lcd_stats.transactions++;
+		lcd_stats.bytes++;
 	}
 	/* If there are parameters or data to send */
 	if (data->databytes != NULL){
-		/* Send parameters or data */
-		GPIOOn(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+		/* Queue parameters or data */
+		SpiQueueWrite(ili9341_spi, data->data, data->databytes, DC_DATA);
+		lcd_stats.transactions++;
+		lcd_stats.bytes += data->databytes;
 	}
 }
 
@@ -217,54 +666,617 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 		x0 = x1;
 		x1 = aux;
 	}
-	/* The lower row must be send first */
-	if (y0 > y1){
-		aux = y0;
-		y0 = y1;
-		y1 = aux;
+	/* The lower row must be send first */
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
+	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
+	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
+	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
+	WriteLCD(&lcd_columns);
+	WriteLCD(&lcd_rows);
+}
+
+void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	rect_t r, clip;
+
+	r.x0 = x0 < x1 ? x0 : x1;
+	r.x1 = x0 < x1 ? x1 : x0;
+	r.y0 = y0 < y1 ? y0 : y1;
+	r.y1 = y0 < y1 ? y1 : y0;
+	if (framebuffer.data != NULL && RectIntersect(&r, &framebuffer.area, &clip)){
+		FramebufferFill(&clip, color);
+		/* Area completely inside the framebuffer: LCD will be updated on next flush */
+		if (memcmp(&r, &clip, sizeof(rect_t)) == 0){
+			FramebufferMark(&clip);
+			return;
+		}
+	}
+	FillPanel(r.x0, r.y0, r.x1, r.y1, color);
+}
+
+void FillPanel(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	static uint32_t i;
+	static int32_t bytes_count, chunk;
+	static int16_t x_dist, y_dist;
+	static uint16_t *pixel;
+
+	x_dist = x1 - x0;
+	y_dist = y1 - y0;
+	if (x0 > x1){
+		x_dist = - x_dist;
+	}
+	if (y0 > y1){
+		y_dist = - y_dist;
+	}
+	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
+	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
+	/* Define area to fill */
+	SetCursorPosition(x0, y0, x1, y1);
+
+	/* Only one buffer is needed: it is filled once and queued as many times as necessary */
+	chunk = bytes_count < DMA_BUFFER_SIZE ? bytes_count : DMA_BUFFER_SIZE;
+	pixel = (uint16_t *)stream_buffer[0];
+	for (i = 0; i < chunk / 2; i++){
+		pixel[i] = WireOrder(color);
+	}
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+
+	while(bytes_count > 0){
+		chunk = bytes_count < DMA_BUFFER_SIZE ? bytes_count : DMA_BUFFER_SIZE;
+		lcd_cmd_t lcd_pixel = {NULL, chunk, stream_buffer[0]};
+		WriteLCD(&lcd_pixel);
+		bytes_count -= chunk;
+	}
+	SpiWaitQueue(ili9341_spi);
+}
+
+void StreamStart(void){
+	stream_bytes = 0;
+}
+
+void StreamSend(void){
+	lcd_cmd_t lcd_pixels = {NULL, stream_bytes, stream_buffer[stream_index]};
+	WriteLCD(&lcd_pixels);
+	stream_index ^= 1;
+	stream_bytes = 0;
+	/* Only the buffer just queued may remain on the wire */
+	SpiWaitPending(ili9341_spi, 1);
+}
+
+static inline void StreamPixel(uint16_t color){
+	if (stream_bytes == DMA_BUFFER_SIZE){
+		StreamSend();
+	}
+	stream_buffer[stream_index][stream_bytes++] = HighByte(color);
+	stream_buffer[stream_index][stream_bytes++] = LowByte(color);
+}
+
+static inline void StreamPixels(const uint16_t *pixels, uint16_t n){
+	uint32_t chunk;
+
+	while (n > 0){
+		if (stream_bytes == DMA_BUFFER_SIZE){
+			StreamSend();
+		}
+		chunk = DMA_BUFFER_SIZE - stream_bytes;
+		if (chunk > n * 2){
+			chunk = n * 2;
+		}
+		memcpy(&stream_buffer[stream_index][stream_bytes], pixels, chunk);
+		stream_bytes += chunk;
+		pixels += chunk / 2;
+		n -= chunk / 2;
+	}
+}
+
+static inline void StreamRun(uint16_t pixel, uint16_t n){
+	/* Not static: kept in registers */
+	uint16_t *dst;
+	uint32_t chunk;
+
+	while (n > 0){
+		if (stream_bytes == DMA_BUFFER_SIZE){
+			StreamSend();
+		}
+		chunk = (DMA_BUFFER_SIZE - stream_bytes) / 2;
+		if (chunk > n){
+			chunk = n;
+		}
+		/* Buffers are word aligned and filled 2 bytes at a time */
+		dst = (uint16_t *)&stream_buffer[stream_index][stream_bytes];
+		stream_bytes += chunk * 2;
+		n -= chunk;
+		while (chunk--){
+			*dst++ = pixel;
+		}
+	}
+}
+
+void StreamEnd(void){
+	if (stream_bytes > 0){
+		StreamSend();
+	}
+	SpiWaitQueue(ili9341_spi);
+}
+
+bool RectIntersect(const rect_t *a, const rect_t *b, rect_t *out){
+	if (a->x0 > b->x1 || b->x0 > a->x1 || a->y0 > b->y1 || b->y0 > a->y1){
+		return false;
+	}
+	out->x0 = a->x0 > b->x0 ? a->x0 : b->x0;
+	out->y0 = a->y0 > b->y0 ? a->y0 : b->y0;
+	out->x1 = a->x1 < b->x1 ? a->x1 : b->x1;
+	out->y1 = a->y1 < b->y1 ? a->y1 : b->y1;
+	return true;
+}
+
+rect_t RectUnion(const rect_t *a, const rect_t *b){
+	rect_t u;
+	u.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+	u.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+	u.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+	u.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+	return u;
+}
+
+uint32_t RectArea(const rect_t *r){
+	return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+void FramebufferMark(const rect_t *r){
+	uint8_t i, best = 0;
+	uint32_t growth, best_growth = UINT32_MAX;
+	rect_t u;
+
+	for (i = 0; i < framebuffer.dirty_count; i++){
+		u = RectUnion(&framebuffer.dirty[i], r);
+		/* Merge when the union does not add more pixels than the new area itself */
+		if (RectArea(&u) <= RectArea(&framebuffer.dirty[i]) + RectArea(r)){
+			framebuffer.dirty[i] = u;
+			return;
+		}
+		growth = RectArea(&u) - RectArea(&framebuffer.dirty[i]);
+		if (growth < best_growth){
+			best_growth = growth;
+			best = i;
+		}
+	}
+	if (framebuffer.dirty_count < FB_DIRTY_MAX){
+		framebuffer.dirty[framebuffer.dirty_count++] = *r;
+	}
+	else{
+		/* List full: grow the area that needs the least extra pixels */
+		framebuffer.dirty[best] = RectUnion(&framebuffer.dirty[best], r);
+	}
+}
+
+void FramebufferFill(const rect_t *r, uint16_t color){
+	uint16_t i, j;
+	uint16_t *row;
+
+	for (i = r->y0; i <= r->y1; i++){
+		row = &framebuffer.data[(i - framebuffer.area.y0) * framebuffer.width + r->x0 - framebuffer.area.x0];
+		for (j = 0; j <= r->x1 - r->x0; j++){
+			row[j] = WireOrder(color);
+		}
+	}
+}
+
+void GlyphLutUpdate(uint16_t foreground, uint16_t background){
+	static uint16_t i, j;
+
+	if (glyph_lut_valid && foreground == glyph_fg && background == glyph_bg){
+		return;
+	}
+	for (i = 0; i < 256; i++){
+		for (j = 0; j < 8; j++){
+			glyph_lut[i][j] = (i & (MSK_BIT8 >> j)) ? WireOrder(foreground) : WireOrder(background);
+		}
+	}
+	glyph_fg = foreground;
+	glyph_bg = background;
+	glyph_lut_valid = true;
+}
+
+const uint16_t * GlyphCacheGet(Font_t *font, char data){
+	static uint16_t i, j, width;
+	static uint32_t size;
+	static const uint8_t *char_row;
+	glyph_t *glyph, *free_slot, *lru;
+
+	if (glyph_cache.budget == 0){
+		return NULL;
+	}
+	free_slot = NULL;
+	for (i = 0; i < GLYPH_CACHE_SLOTS; i++){
+		glyph = &glyph_cache.glyph[i];
+		if (glyph->pixels == NULL){
+			free_slot = glyph;
+		}
+		else if (glyph->font == font && glyph->data == data &&
+				glyph->foreground == glyph_fg && glyph->background == glyph_bg){
+			glyph->last_use = glyph_cache.tick;
+			lcd_stats.glyph_hits++;
+			return glyph->pixels;
+		}
+	}
+	lcd_stats.glyph_misses++;
+	width = font->info[data - ' '].width;
+	size = width * font->font_height * sizeof(uint16_t);
+	if (size > glyph_cache.budget){
+		return NULL;
+	}
+	/* Evict least recently used glyphs until the new one fits */
+	while (free_slot == NULL || glyph_cache.used + size > glyph_cache.budget){
+		lru = NULL;
+		for (i = 0; i < GLYPH_CACHE_SLOTS; i++){
+			glyph = &glyph_cache.glyph[i];
+			if (glyph->pixels != NULL && glyph->last_use != glyph_cache.tick &&
+					(lru == NULL || glyph->last_use < lru->last_use)){
+				lru = glyph;
+			}
+		}
+		if (lru == NULL){
+			return NULL;
+		}
+		heap_caps_free(lru->pixels);
+		lru->pixels = NULL;
+		glyph_cache.used -= lru->size;
+		free_slot = lru;
+	}
+	/* DMA capable memory, so glyphs can be sent to the LCD without copies */
+	free_slot->pixels = heap_caps_malloc(size, MALLOC_CAP_DMA);
+	if (free_slot->pixels == NULL){
+		return NULL;
+	}
+	for (i = 0; i < font->font_height; i++){
+		char_row = &font->data[font->info[data - ' '].offset + i * ((width + 7) / 8)];
+		for (j = 0; j < width; j += 8){
+			memcpy(&free_slot->pixels[i * width + j], glyph_lut[char_row[j / 8]], ((width - j) < 8 ? (width - j) : 8) * sizeof(uint16_t));
+		}
+	}
+	free_slot->font = font;
+	free_slot->data = data;
+	free_slot->foreground = glyph_fg;
+	free_slot->background = glyph_bg;
+	free_slot->size = size;
+	free_slot->last_use = glyph_cache.tick;
+	glyph_cache.used += size;
+	return free_slot->pixels;
+}
+
+uint16_t TextWidth(const char *str, uint16_t len, Font_t *font, uint8_t gap, uint8_t cell){
+	static uint16_t i, width;
+
+	if (cell > 0){
+		return len * (cell + gap) - gap;
+	}
+	width = 0;
+	for (i = 0; i < len; i++){
+		width += font->info[str[i] - ' '].width + gap;
+	}
+	return width - gap;
+}
+
+void TextLine(uint16_t x, uint16_t y, const char *str, uint16_t len, Font_t *font, uint8_t gap, uint8_t cell){
+	static uint16_t i, j, k, width, pad;
+	static uint32_t size, chunk;
+	static const uint8_t *char_row;
+
+	if (len == 0){
+		return;
+	}
+	glyph_cache.tick++;
+	for (k = 0; k < len && k < TEXT_LINE_MAX; k++){
+		line_glyphs[k] = GlyphCacheGet(font, str[k]);
+	}
+	WindowStart(x, y, x + TextWidth(str, len, font, gap, cell) - 1, y + font->font_height - 1);
+	width = font->info[str[0] - ' '].width;
+	if (len == 1 && line_glyphs[0] != NULL && cell <= width && !window.to_fb){
+		/* Single cached glyph: sent straight from the cache */
+		size = width * font->font_height * sizeof(uint16_t);
+		for (j = 0; size > 0; size -= chunk, j += chunk / 2){
+			chunk = (size > DMA_BUFFER_SIZE) ? DMA_BUFFER_SIZE : size;
+			lcd_cmd_t lcd_pixels = {NULL, chunk, (uint8_t *)&line_glyphs[0][j]};
+			WriteLCD(&lcd_pixels);
+		}
+		WindowEnd();
+		return;
+	}
+	/* The whole line is sent row by row: a row of each character, then the next row */
+	for (i = 0; i < font->font_height; i++){
+		for (k = 0; k < len; k++){
+			width = font->info[str[k] - ' '].width;
+			if (k < TEXT_LINE_MAX && line_glyphs[k] != NULL){
+				/* Row of the pre-rendered glyph */
+				WindowPixels(&line_glyphs[k][i * width], width);
+			}
+			else{
+				char_row = &font->data[font->info[str[k] - ' '].offset + i * ((width + 7) / 8)];
+				/* Each byte of the row expands to 8 pixels */
+				for (j = 0; j < width; j += 8){
+					WindowPixels(glyph_lut[char_row[j / 8]], (width - j) < 8 ? (width - j) : 8);
+				}
+			}
+			/* Background up to the cell width and between characters */
+			pad = (cell > width) ? (cell - width) : 0;
+			if (k < len - 1){
+				pad += gap;
+			}
+			for (; pad > 8; pad -= 8){
+				WindowPixels(glyph_lut[0], 8);
+			}
+			WindowPixels(glyph_lut[0], pad);
+		}
+	}
+	WindowEnd();
+}
+
+void AALutUpdate(uint16_t foreground, uint16_t background, uint8_t bpp){
+	static uint16_t i, levels, r, g, b;
+
+	if (bpp == aa_bpp && foreground == aa_fg && background == aa_bg){
+		return;
+	}
+	levels = (1 << bpp) - 1;
+	/* Blend each RGB565 channel from background to foreground */
+	for (i = 0; i <= levels; i++){
+		r = (((background >> 11) & 0x1F) * (levels - i) + ((foreground >> 11) & 0x1F) * i + levels / 2) / levels;
+		g = (((background >> 5) & 0x3F) * (levels - i) + ((foreground >> 5) & 0x3F) * i + levels / 2) / levels;
+		b = ((background & 0x1F) * (levels - i) + (foreground & 0x1F) * i + levels / 2) / levels;
+		aa_lut[i] = WireOrder((uint16_t)(r << 11 | g << 5 | b));
+	}
+	aa_fg = foreground;
+	aa_bg = background;
+	aa_bpp = bpp;
+}
+
+const aa_char_info_t * AAInfo(AAFont_t *font, char data){
+	if (data < font->first || data > font->last){
+		data = font->first;
+	}
+	return &font->info[data - font->first];
+}
+
+uint16_t TextWidthAA(const char *str, uint16_t len, AAFont_t *font, uint8_t gap){
+	static uint16_t i, width;
+
+	width = 0;
+	for (i = 0; i < len; i++){
+		width += AAInfo(font, str[i])->width + gap;
+	}
+	return width - gap;
+}
+
+void TextLineAA(uint16_t x, uint16_t y, const char *str, uint16_t len, AAFont_t *font, uint8_t gap){
+	/* Not static: inner loop of anti-aliased text, kept in registers */
+	uint16_t i, j, k, width, run;
+	uint8_t code, mask;
+
+	if (len == 0){
+		return;
+	}
+	mask = (1 << font->bpp) - 1;
+	for (k = 0; k < len; k++){
+		aa_rows[k] = &font->data[AAInfo(font, str[k])->offset];
+		aa_widths[k] = AAInfo(font, str[k])->width;
+	}
+	WindowStart(x, y, x + TextWidthAA(str, len, font, gap) - 1, y + font->font_height - 1);
+	/* The whole line is sent row by row: a row of each character, then the next row */
+	for (i = 0; i < font->font_height; i++){
+		for (k = 0; k < len; k++){
+			width = aa_widths[k];
+			/* Runs of the row, each one a length and an intensity */
+			for (j = 0; j < width; j += run){
+				code = *aa_rows[k]++;
+				run = (code >> font->bpp) + 1;
+				WindowRun(aa_lut[code & mask], run);
+			}
+			if (k < len - 1){
+				/* Background between characters */
+				WindowRun(aa_lut[0], gap);
+			}
+		}
+	}
+	WindowEnd();
+}
+
+void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	static int16_t aux;
+
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Completely outside the LCD */
+	if (x1 < 0 || y1 < 0 || x0 >= lcd_orientation.width || y0 >= lcd_orientation.height){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	Fill(x0, y0, x1, y1, color);
+}
+
+void CircleSpans(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y, uint16_t color){
+	/* Top and bottom octants: horizontal runs */
+	Span(x0 + xa, y0 + y, x0 + xb, y0 + y, color);
+	Span(x0 - xb, y0 + y, x0 - xa, y0 + y, color);
+	Span(x0 + xa, y0 - y, x0 + xb, y0 - y, color);
+	Span(x0 - xb, y0 - y, x0 - xa, y0 - y, color);
+	/* Left and right octants: vertical runs */
+	Span(x0 + y, y0 + xa, x0 + y, y0 + xb, color);
+	Span(x0 - y, y0 + xa, x0 - y, y0 + xb, color);
+	Span(x0 + y, y0 - xb, x0 + y, y0 - xa, color);
+	Span(x0 - y, y0 - xb, x0 - y, y0 - xa, color);
+}
+
+void RenderTask(void *param){
+	static render_cmd_t cmd, next;
+
+	while (true){
+		xQueueReceive(render_queue, &cmd, portMAX_DELAY);
+		/* A fill covered by the next one is never seen: only the last one is drawn */
+		while (cmd.id == RENDER_FILL && xQueuePeek(render_queue, &next, 0) == pdTRUE &&
+			next.id == RENDER_FILL && next.area.x0 <= cmd.area.x0 && next.area.y0 <= cmd.area.y0 &&
+			next.area.x1 >= cmd.area.x1 && next.area.y1 >= cmd.area.y1){
+			xQueueReceive(render_queue, &cmd, 0);
+			lcd_stats.fills_coalesced++;
+		}
+		switch (cmd.id){
+		case RENDER_FILL:
+			Fill(cmd.area.x0, cmd.area.y0, cmd.area.x1, cmd.area.y1, cmd.foreground);
+			break;
+		case RENDER_LINE:
+			ILI9341DrawLine(cmd.area.x0, cmd.area.y0, cmd.area.x1, cmd.area.y1, cmd.foreground);
+			break;
+		case RENDER_STRING:
+			ILI9341DrawString(cmd.area.x0, cmd.area.y0, cmd.text, cmd.font, cmd.foreground, cmd.background);
+			break;
+		case RENDER_INT:
+			ILI9341DrawInt(cmd.area.x0, cmd.area.y0, cmd.value, cmd.digits, cmd.font, cmd.foreground, cmd.background);
+			break;
+		case RENDER_STRIP:
+			ILI9341StripAdd(cmd.value);
+			break;
+		case RENDER_CONSOLE:
+			ILI9341ConsolePrint(cmd.text);
+			break;
+		case RENDER_FLUSH:
+			ILI9341Flush();
+			break;
+		case RENDER_FENCE:
+			xSemaphoreGive(cmd.fence);
+			break;
+		}
+	}
+}
+
+void RenderPost(render_cmd_t *cmd){
+	xQueueSend(render_queue, cmd, portMAX_DELAY);
+}
+
+uint16_t ScrollNext(uint16_t n){
+	if (scroll.reversed){
+		/* Lines pos - n ... pos - 1 (wrapped to the area), which grow towards smaller coordinates */
+		return ILI9341_HEIGHT - n - (scroll.first + (scroll.pos - scroll.first + scroll.lines - n) % scroll.lines);
+	}
+	return scroll.pos;
+}
+
+void ScrollLines(uint16_t n){
+	uint8_t vsp[2];
+
+	if (scroll.reversed){
+		scroll.pos = scroll.first + (scroll.pos - scroll.first + scroll.lines - n) % scroll.lines;
+	}
+	else{
+		scroll.pos = scroll.first + (scroll.pos - scroll.first + n) % scroll.lines;
+	}
+	vsp[0] = HighByte(scroll.pos);
+	vsp[1] = LowByte(scroll.pos);
+	lcd_cmd_t lcd_vsp = {VERT_SCROLL_ADDR, 2, vsp};
+	WriteLCD(&lcd_vsp);
+	SpiWaitQueue(ili9341_spi);
+}
+
+void WindowStart(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	rect_t clip;
+
+	window.area.x0 = x0;
+	window.area.y0 = y0;
+	window.area.x1 = x1;
+	window.area.y1 = y1;
+	window.x = x0;
+	window.y = y0;
+	window.to_fb = framebuffer.data != NULL && RectIntersect(&window.area, &framebuffer.area, &clip);
+	window.to_panel = !window.to_fb || memcmp(&window.area, &clip, sizeof(rect_t)) != 0;
+	if (window.to_panel){
+		SetCursorPosition(x0, y0, x1, y1);
+		/* Start writing LCD memory */
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		StreamStart();
+	}
+	else{
+		FramebufferMark(&window.area);
+	}
+}
+
+static inline void WindowPixel(uint16_t color){
+	if (window.to_panel){
+		StreamPixel(color);
+	}
+	if (window.to_fb){
+		WindowFbPixel(WireOrder(color));
+	}
+}
+
+static inline void WindowPixels(const uint16_t *pixels, uint16_t n){
+	static uint16_t i;
+
+	if (window.to_panel){
+		StreamPixels(pixels, n);
+	}
+	if (window.to_fb){
+		for (i = 0; i < n; i++){
+			WindowFbPixel(pixels[i]);
+		}
 	}
-	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
-	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
-	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
-	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
 }
 
-void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+static inline void WindowRun(uint16_t pixel, uint16_t n){
 	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
-	x_dist = x1 - x0;
-	y_dist = y1 - y0;
-	if (x0 > x1){
-		x_dist = - x_dist;
+	if (window.to_panel){
+		StreamRun(pixel, n);
 	}
-	if (y0 > y1){
-		y_dist = - y_dist;
+	if (window.to_fb){
+		for (i = 0; i < n; i++){
+			WindowFbPixel(pixel);
+		}
 	}
-	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
-	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
-	/* Define area to fill */
-	SetCursorPosition(x0, y0, x1, y1);
+}
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+static inline void WindowFbPixel(uint16_t pixel){
+	if (window.x >= framebuffer.area.x0 && window.x <= framebuffer.area.x1 &&
+		window.y >= framebuffer.area.y0 && window.y <= framebuffer.area.y1){
+		framebuffer.data[(window.y - framebuffer.area.y0) * framebuffer.width + window.x - framebuffer.area.x0] = pixel;
 	}
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	if (window.x == window.area.x1){
+		window.x = window.area.x0;
+		window.y++;
+	}
+	else{
+		window.x++;
+	}
+}
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+void WindowEnd(void){
+	if (window.to_panel){
+		StreamEnd();
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
 }
 
 /*==================[external functions definition]==========================*/
@@ -272,12 +1284,31 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	/* SPI configuration */
 	spi_conf.device = spi_dev;
+	spi_conf.pre_func_p = SetDC;
 	ili9341_spi = spi_dev;
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
 	GPIOInit(ili9341_dc, GPIO_OUTPUT);
 	GPIOInit(ili9341_rst, GPIO_OUTPUT);
+	/* Pixel streaming buffers are kept while the LCD is in use */
+	if (stream_buffer[0] == NULL){
+		stream_buffer[0] = DmaBufferTake(DMA_POOL_NO_WAIT);
+		stream_buffer[1] = DmaBufferTake(DMA_POOL_NO_WAIT);
+	}
+	if (stream_buffer[0] == NULL || stream_buffer[1] == NULL || DmaBufferSize() < DMA_BUFFER_SIZE){
+		DmaBufferGive(stream_buffer[0]);
+		DmaBufferGive(stream_buffer[1]);
+		stream_buffer[0] = stream_buffer[1] = NULL;
+		return false;
+	}
+	/* The LCD is registered in the SPI bus only once */
+	if (SpiInit(&spi_conf) != 0){
+		DmaBufferGive(stream_buffer[0]);
+		DmaBufferGive(stream_buffer[1]);
+		stream_buffer[0] = stream_buffer[1] = NULL;
+		return false;
+	}
 
 	/* RST must be held low for minimum 10µsec after VCC have been applied */
 	DelayUs(10);
@@ -286,6 +1317,7 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	DelayUs(10);
 	/* It will be necessary to wait 5msec before sending new command following software reset */
 	WriteLCD(&lcd_reset);
+	SpiWaitQueue(ili9341_spi);
 	DelayMs(5);
 	/* Send initial configuration to LCD */
 	for (uint8_t i = 0; i < sizeof(lcd_init)/sizeof(lcd_cmd_t); i++){
@@ -293,8 +1325,10 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	}
 	/* It will be necessary to wait 5msec before sending next command after sleep out */
 	WriteLCD(&lcd_sleep_out);
+	SpiWaitQueue(ili9341_spi);
 	DelayMs(10);
 	WriteLCD(&lcd_on);
+	SpiWaitQueue(ili9341_spi);
 	DelayMs(20);
 	/* Start screen on White */
 	ILI9341Fill(ILI9341_WHITE);
@@ -304,14 +1338,11 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
 	/* Define area (pixel) to fill */
-	SetCursorPosition(x, y, x, y);
-	uint8_t pixels[] = {HighByte(color), LowByte(color)};
-	lcd_cmd_t lcd_pixels = {MEM_WRITE, sizeof(pixels), pixels};
-	WriteLCD(&lcd_pixels);
+	Fill(x, y, x, y, color);
 }
 
 void ILI9341Fill(uint16_t color){
-	Fill(0, 0, lcd_orientation.width, lcd_orientation.height, color);
+	Fill(0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1, color);
 }
 
 void ILI9341Rotate(ili9341_orientation_t orientation){
@@ -345,16 +1376,25 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 		lcd_orientation.orientation = ILI9341_Landscape_2;
 		break;
 	}
+	/* Scrolling area is defined for the previous orientation */
+	ILI9341ScrollDeInit();
 	lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
 	WriteLCD(&lcd_mem_acc);
+	SpiWaitQueue(ili9341_spi);
+	/* Framebuffer area keeps its coordinates: it is sent whole on next flush, or disabled if it no longer fits */
+	if (framebuffer.data != NULL){
+		if (framebuffer.area.x1 < lcd_orientation.width && framebuffer.area.y1 < lcd_orientation.height){
+			framebuffer.dirty[0] = framebuffer.area;
+			framebuffer.dirty_count = 1;
+		}
+		else{
+			ILI9341FramebufferDeInit();
+		}
+	}
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -366,57 +1406,14 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
-	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	GlyphLutUpdate(foreground, background);
+	TextLine(lcd_x, lcd_y, &data, 1, font, 0, 0);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
+	static uint32_t i, j;
+	static const uint8_t *char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -428,73 +1425,100 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	GlyphLutUpdate(foreground, background);
+	WindowStart(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
 
 	/* Draw font data */
 	/* go through character rows */
-	k = 0;
 	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+		char_row = &icon_font->data[icon * icon_font->offset + i * ((icon_font->width + 7) / 8)];
+		/* go through character columns, 8 pixels at a time */
+		for (j = 0; j < icon_font->width; j += 8){
+			WindowPixels(glyph_lut[char_row[j / 8]], (icon_font->width - j) < 8 ? (icon_font->width - j) : 8);
 		}
 	}
 	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	WindowEnd();
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint16_t i;
-	static uint16_t lcd_x, lcd_y;
+	static char digits[INT_MAX_DIGITS];
+	static uint8_t i, cell;
+
+	if (dig > INT_MAX_DIGITS){
+		dig = INT_MAX_DIGITS;
+	}
+	cell = 0;
+	for (i = 0; i < dig; i++){
+		digits[dig - 1 - i] = num % 10 + '0';
+		num = num / 10;
+	}
+	/* Every digit takes the width of the widest one, so numbers keep their position when updated */
+	for (i = 0; i < 10; i++){
+		if (font->info['0' + i - ' '].width > cell){
+			cell = font->info['0' + i - ' '].width;
+		}
+	}
+	/* All digits are drawn side by side on a single window */
+	GlyphLutUpdate(foreground, background);
+	TextLine(x, y, digits, dig, font, GLYPH_GAP, cell);
+}
+
+void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
+	static uint16_t lcd_x, lcd_y, len, width;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
-	for (i=0; i<dig; i++){
-		lcd_x = x + font->info[num%10 + '0' - ' '].width * (dig-1-i) + 1;
-		ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
-		num = num/10;
+	GlyphLutUpdate(foreground, background);
+	while (*str != '\0'){	/* End of string */
+		/* New line */
+		if (*str == '\n'){
+			lcd_y += font->font_height + 1;
+			/* if after \n is also \r, than go to the left of the screen */
+			if (*(str + 1) == '\r'){
+				lcd_x = 0;
+				str++;
+			}
+			else{
+				lcd_x = x;
+			}
+			str++;
+			continue;
+		}
+		else if (*str == '\r'){
+			str++;
+			continue;
+		}
+		/* If at the end of a line of display, go to new line and set x to 0 position */
+		if (lcd_x > 0 && (lcd_x + font->info[*str - ' '].width) > lcd_orientation.width){
+			lcd_y += font->font_height + 1;
+			lcd_x = 0;
+		}
+		/* Take all the characters up to the end of the line (of text or of display) */
+		len = 1;
+		width = font->info[*str - ' '].width;
+		while (str[len] != '\0' && str[len] != '\n' && str[len] != '\r' &&
+			(lcd_x + width + GLYPH_GAP + font->info[str[len] - ' '].width) <= lcd_orientation.width){
+			width += GLYPH_GAP + font->info[str[len] - ' '].width;
+			len++;
+		}
+		/* Put characters to LCD */
+		TextLine(lcd_x, lcd_y, str, len, font, GLYPH_GAP, 0);
+		lcd_x += width + GLYPH_GAP;
+		str += len;
 	}
 }
 
-void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
-	static uint16_t lcd_x, lcd_y;
+void ILI9341DrawStringAA(uint16_t x, uint16_t y, char* str, AAFont_t *font, uint16_t foreground, uint16_t background){
+	static uint16_t lcd_x, lcd_y, len, width;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
+	AALutUpdate(foreground, background, font->bpp);
 	while (*str != '\0'){	/* End of string */
 		/* New line */
 		if (*str == '\n'){
@@ -508,17 +1532,89 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 				lcd_x = x;
 			}
 			str++;
+			continue;
 		}
 		else if (*str == '\r'){
-				str++;
-			}
+			str++;
+			continue;
+		}
+		/* If at the end of a line of display, go to new line and set x to 0 position */
+		if (lcd_x > 0 && (lcd_x + AAInfo(font, *str)->width) > lcd_orientation.width){
+			lcd_y += font->font_height + 1;
+			lcd_x = 0;
+		}
+		/* Take all the characters up to the end of the line (of text or of display) */
+		len = 1;
+		width = AAInfo(font, *str)->width;
+		while (str[len] != '\0' && str[len] != '\n' && str[len] != '\r' && len < TEXT_LINE_MAX &&
+			(lcd_x + width + GLYPH_GAP + AAInfo(font, str[len])->width) <= lcd_orientation.width){
+			width += GLYPH_GAP + AAInfo(font, str[len])->width;
+			len++;
+		}
+		/* Put characters to LCD */
+		TextLineAA(lcd_x, lcd_y, str, len, font, GLYPH_GAP);
+		lcd_x += width + GLYPH_GAP;
+		str += len;
+	}
+}
 
-		/* Put character to LCD */
-		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-		lcd_x += font->info[*str - ' '].width + 1;
-		/* Next character */
+void ILI9341GetStringSizeAA(char* str, AAFont_t* font, uint16_t* width, uint16_t* height){
+	static uint16_t w;
+
+	*height = font->font_height;
+	w = 0;
+	while (*str != '\0'){	/* End of string */
+		w += AAInfo(font, *str)->width + GLYPH_GAP;
 		str++;
 	}
+	*width = w;
+}
+
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t *image){
+	static uint16_t recent[64];
+	/* Not static: inner loop of the decoder, kept in registers */
+	const uint8_t *data;
+	uint16_t pixel;
+	int32_t count;
+	uint8_t tag, n;
+
+	memset(recent, 0, sizeof(recent));
+	pixel = 0;
+	data = image->data;
+	count = image->width * image->height;
+	WindowStart(x, y, x + image->width - 1, y + image->height - 1);
+	/* Pixels are decoded into the stream buffers while the previous one is transmitted */
+	while (count > 0){
+		tag = *data++;
+		n = (tag & IMG_VALUE_MASK) + 1;
+		switch (tag & IMG_TAG_MASK){
+		case IMG_INDEX:
+			pixel = recent[tag & IMG_VALUE_MASK];
+			WindowPixel(pixel);
+			count--;
+			break;
+		case IMG_RUN:
+			WindowRun(WireOrder(pixel), n);
+			count -= n;
+			break;
+		case IMG_DIFF:
+			/* Channels never overflow, so the differences can be added to the whole pixel */
+			pixel += (((tag >> 4) & 0x03) << 11) + (((tag >> 2) & 0x03) << 5) + (tag & 0x03);
+			pixel -= (2 << 11) + (2 << 5) + 2;
+			recent[ImageHash(pixel)] = pixel;
+			WindowPixel(pixel);
+			count--;
+			break;
+		case IMG_LITERAL:
+			for (count -= n; n > 0; n--, data += 2){
+				pixel = data[0] << 8 | data[1];
+				recent[ImageHash(pixel)] = pixel;
+				WindowPixel(pixel);
+			}
+			break;
+		}
+	}
+	WindowEnd();
 }
 
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height){
@@ -536,6 +1632,8 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static uint16_t span_x, span_y;
+	static bool step_x, step_y;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -576,25 +1674,37 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	/* Diagonal line */
 	else{
 		error = x_dist - y_dist;
+		/* Consecutive pixels on the same row (or column, for steep lines) are drawn as one span */
+		span_x = x0;
+		span_y = y0;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
 			if (x0 == x1 && y0 == y1){
+				Fill(span_x, span_y, x0, y0, color);
 				break;
 			}
 			error_2 = 2 * error;
+			step_x = error_2 > -y_dist;
+			step_y = error_2 < x_dist;
+			/* Span ends when the line leaves the current row (or column) */
+			if (x_dist >= y_dist ? step_y : step_x){
+				Fill(span_x, span_y, x0, y0, color);
+			}
 			/* Determine if line must grow in x direction */
-			if (error_2 > -y_dist){
+			if (step_x){
 				error -= y_dist;
 				x0 += x_grow;	/* Move start point */
 			}
 			/* Determine if line must grow in y direction */
-			if (error_2 < x_dist){
+			if (step_y){
 				error += x_dist;
 				y0 += y_grow;	/* Move start point */
 			}
+			if (x_dist >= y_dist ? step_y : step_x){
+				span_x = x0;
+				span_y = y0;
+			}
 		}
 	}
 }
@@ -611,39 +1721,30 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	static int16_t f, ddF_x, ddF_y, x, y, x_start;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
-
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
+	/* Points of an octant with the same y are drawn as a single span */
+	x_start = 0;
 
     while (x < y){
         if (f >= 0){
+			/* Next point is on another row: draw the run */
+			CircleSpans(x0, y0, x_start, x, y, color);
             y--;
             ddF_y += 2;
             f += ddF_y;
+			x_start = x + 1;
         }
         x++;
         ddF_x += 2;
         f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
     }
+	CircleSpans(x0, y0, x_start, x, y, color);
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
@@ -655,14 +1756,14 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 	x = 0;
 	y = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
+	/* Center row */
+	Span(x0 - r, y0, x0 + r, y0, color);
 
     while (x < y){
         if (f >= 0){
+			/* Rows y0 +/- y are complete: draw them once, with their widest span */
+			Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+			Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -671,12 +1772,12 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         ddF_x += 2;
         f += ddF_x;
 
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
+		/* Rows y0 +/- x */
+		Span(x0 - y, y0 + x, x0 + y, y0 + x, color);
+		Span(x0 - y, y0 - x, x0 + y, y0 - x, color);
     }
+	Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+	Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -747,7 +1848,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -761,7 +1862,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
@@ -778,7 +1879,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -790,47 +1891,426 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
+		Span(x_1, y_1, x_aux, y_aux, color);
   	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
 	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
 	bytes_count = width * height * 2;
 
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	WindowStart(x, y, x + width - 1, y + height - 1);
+	if (window.to_fb){
+		for (; bytes_count > 0; bytes_count -= 2, pic += 2){
+			WindowPixel(pic[0] << 8 | pic[1]);
+		}
+	}
+	else{
+		/* Picture is stored in flash: copy it to the DMA buffers while the previous block is transmitted */
+		while(bytes_count > 0){
+			stream_bytes = bytes_count < DMA_BUFFER_SIZE ? bytes_count : DMA_BUFFER_SIZE;
+			memcpy(stream_buffer[stream_index], pic, stream_bytes);
+			pic += stream_bytes;
+			bytes_count -= stream_bytes;
+			StreamSend();
+		}
+	}
+	WindowEnd();
+}
+
+uint8_t ILI9341FramebufferInit(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	rect_t r, screen = {0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1};
+
+	ILI9341FramebufferDeInit();
+	r.x0 = x0 < x1 ? x0 : x1;
+	r.x1 = x0 < x1 ? x1 : x0;
+	r.y0 = y0 < y1 ? y0 : y1;
+	r.y1 = y0 < y1 ? y1 : y0;
+	if (!RectIntersect(&r, &screen, &framebuffer.area)){
+		return false;
+	}
+	framebuffer.width = framebuffer.area.x1 - framebuffer.area.x0 + 1;
+	/* DMA capable memory, so full width areas can be sent to the LCD without copies */
+	framebuffer.data = heap_caps_malloc(RectArea(&framebuffer.area) * sizeof(uint16_t), MALLOC_CAP_DMA);
+	if (framebuffer.data == NULL){
+		return false;
+	}
+	FramebufferFill(&framebuffer.area, color);
+	framebuffer.dirty[0] = framebuffer.area;
+	framebuffer.dirty_count = 1;
+	return true;
+}
+
+void ILI9341Flush(void){
+	static uint8_t i;
+	static uint16_t row;
+	static uint32_t row_bytes, bytes_count, chunk;
+	static const uint8_t *src;
+	rect_t *r;
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	if (framebuffer.data == NULL){
+		return;
+	}
+	for (i = 0; i < framebuffer.dirty_count; i++){
+		r = &framebuffer.dirty[i];
+		SetCursorPosition(r->x0, r->y0, r->x1, r->y1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		row_bytes = (r->x1 - r->x0 + 1) * 2;
+		src = (const uint8_t *)&framebuffer.data[(r->y0 - framebuffer.area.y0) * framebuffer.width + r->x0 - framebuffer.area.x0];
+		if (r->x1 - r->x0 + 1 == framebuffer.width){
+			/* Full width rows are contiguous: queue them straight from the framebuffer */
+			bytes_count = row_bytes * (r->y1 - r->y0 + 1);
+			while (bytes_count > 0){
+				chunk = bytes_count < DMA_BUFFER_SIZE ? bytes_count : DMA_BUFFER_SIZE;
+				lcd_cmd_t lcd_pixel = {NULL, chunk, (uint8_t *)src};
+				WriteLCD(&lcd_pixel);
+				src += chunk;
+				bytes_count -= chunk;
+			}
+			SpiWaitQueue(ili9341_spi);
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+		else{
+			/* Gather rows into the stream buffers */
+			StreamStart();
+			for (row = r->y0; row <= r->y1; row++){
+				bytes_count = row_bytes;
+				while (bytes_count > 0){
+					if (stream_bytes == DMA_BUFFER_SIZE){
+						StreamSend();
+					}
+					chunk = DMA_BUFFER_SIZE - stream_bytes;
+					chunk = bytes_count < chunk ? bytes_count : chunk;
+					memcpy(&stream_buffer[stream_index][stream_bytes], src + row_bytes - bytes_count, chunk);
+					stream_bytes += chunk;
+					bytes_count -= chunk;
+				}
+				src += framebuffer.width * 2;
+			}
+			StreamEnd();
+		}
+	}
+	framebuffer.dirty_count = 0;
+}
+
+uint8_t ILI9341ScrollInit(uint16_t start, uint16_t end){
+	static uint16_t aux, top, bottom;
+	uint8_t vscrdef[6];
+
+	if (start > end){
+		aux = start;
+		start = end;
+		end = aux;
+	}
+	if (end >= ILI9341_HEIGHT){
+		return false;
+	}
+	scroll.reversed = (lcd_orientation.orientation == ILI9341_Portrait_2 || lcd_orientation.orientation == ILI9341_Landscape_2);
+	if (scroll.reversed){
+		scroll.first = ILI9341_HEIGHT - 1 - end;
+	}
+	else{
+		scroll.first = start;
+	}
+	scroll.lines = end - start + 1;
+	scroll.pos = scroll.first;
+	top = scroll.first;
+	bottom = ILI9341_HEIGHT - scroll.first - scroll.lines;
+	/* Top fixed area, scrolling area and bottom fixed area */
+	vscrdef[0] = HighByte(top);
+	vscrdef[1] = LowByte(top);
+	vscrdef[2] = HighByte(scroll.lines);
+	vscrdef[3] = LowByte(scroll.lines);
+	vscrdef[4] = HighByte(bottom);
+	vscrdef[5] = LowByte(bottom);
+	lcd_cmd_t lcd_vscrdef = {VERT_SCROLL_DEF, 6, vscrdef};
+	WriteLCD(&lcd_vscrdef);
+	scroll.enabled = true;
+	ScrollLines(0);
+	return true;
+}
+
+void ILI9341ScrollDeInit(void){
+	if (scroll.enabled){
+		/* Whole memory as scrolling area, not scrolled */
+		ILI9341ScrollInit(0, ILI9341_HEIGHT - 1);
+		scroll.enabled = false;
+	}
+}
+
+uint8_t ILI9341StripInit(ili9341_strip_t *config){
+	if (config->max <= config->min || config->low > config->high ||
+		!ILI9341ScrollInit(config->start, config->end)){
+		return false;
+	}
+	strip = *config;
+	strip_last = 0xFFFF;
+	if (lcd_orientation.width > lcd_orientation.height){
+		Span(strip.start, strip.low, strip.end, strip.high, strip.background);
+	}
+	else{
+		Span(strip.low, strip.start, strip.high, strip.end, strip.background);
+	}
+	return true;
+}
+
+void ILI9341StripAdd(int32_t value){
+	static uint16_t line, pos, i, from, to, offset;
+
+	if (!scroll.enabled || strip.max <= strip.min){
+		return;
+	}
+	if (value < strip.min){
+		value = strip.min;
+	}
+	if (value > strip.max){
+		value = strip.max;
+	}
+	/* 64 bits: the range of an int32_t does not fit in 32 bits, nor its product by the plot size */
+	offset = ((int64_t)value - strip.min) * (strip.high - strip.low) / ((int64_t)strip.max - strip.min);
+	line = ScrollNext(1);
+	if (lcd_orientation.width > lcd_orientation.height){
+		/* Landscape: samples are columns, values grow up */
+		pos = strip.high - offset;
+		WindowStart(line, strip.low, line, strip.high);
+	}
+	else{
+		/* Portrait: samples are rows, values grow to the right */
+		pos = strip.low + offset;
+		WindowStart(strip.low, line, strip.high, line);
+	}
+	/* Segment from the last sample to the new one, so the trace has no gaps */
+	if (strip_last == 0xFFFF){
+		strip_last = pos;
+	}
+	from = (strip_last < pos) ? strip_last : pos;
+	to = (strip_last < pos) ? pos : strip_last;
+	for (i = strip.low; i <= strip.high; i++){
+		WindowPixel((i >= from && i <= to) ? strip.foreground : strip.background);
+	}
+	WindowEnd();
+	strip_last = pos;
+	ScrollLines(1);
+}
+
+uint8_t ILI9341ConsoleInit(uint16_t start, uint16_t end, Font_t *font, uint16_t foreground, uint16_t background){
+	static uint16_t aux, line_height;
+
+	/* Text lines must scroll vertically */
+	if (lcd_orientation.width > lcd_orientation.height){
+		return false;
+	}
+	if (start > end){
+		aux = start;
+		start = end;
+		end = aux;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	/* Area must be a whole number of lines of text */
+	line_height = font->font_height + 1;
+	if (end - start + 1 < line_height){
+		return false;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	end -= (end - start + 1) % line_height;
+	if (!ILI9341ScrollInit(start, end)){
+		return false;
+	}
+	console.font = font;
+	console.foreground = foreground;
+	console.background = background;
+	Span(0, start, lcd_orientation.width - 1, end, background);
+	return true;
+}
+
+void ILI9341ConsolePrint(char* str){
+	static uint16_t y, len, width, line_height;
+	static char line[CONSOLE_LINE_MAX];
+	char c;
+
+	if (!scroll.enabled || console.font == NULL){
+		return;
+	}
+	line_height = console.font->font_height + 1;
+	GlyphLutUpdate(console.foreground, console.background);
+	do{
+		/* Each line of text is drawn on the lines about to scroll out of the area */
+		y = ScrollNext(line_height);
+		/* Characters that don't fit on the LCD are discarded, '\r' is ignored and 
+		 * characters out of the font (tabs, control characters) are drawn as spaces */
+		len = 0;
+		width = 0;
+		for (; *str != '\0' && *str != '\n' && len < CONSOLE_LINE_MAX; str++){
+			c = *str;
+			if (c == '\r'){
+				continue;
+			}
+			if ((uint8_t)c < (uint8_t)FONT_FIRST || (uint8_t)c > (uint8_t)FONT_LAST){
+				c = ' ';
+			}
+			if ((width + console.font->info[c - FONT_FIRST].width) > lcd_orientation.width){
+				break;
+			}
+			width += console.font->info[c - FONT_FIRST].width + GLYPH_GAP;
+			line[len++] = c;
+		}
+		TextLine(0, y, line, len, console.font, GLYPH_GAP, 0);
+		if (width < lcd_orientation.width){
+			Span(width > 0 ? width - GLYPH_GAP : 0, y, lcd_orientation.width - 1, y + console.font->font_height - 1, console.background);
+		}
+		/* Space between lines */
+		Span(0, y + console.font->font_height, lcd_orientation.width - 1, y + console.font->font_height, console.background);
+		ScrollLines(line_height);
+		/* Next line of text */
+		while (*str != '\0' && *str != '\n'){
+			str++;
+		}
+	} while (*str++ != '\0');
+}
+
+uint8_t ILI9341AsyncInit(uint8_t queue_length, uint8_t priority){
+	if (render_queue != NULL){
+		return true;
+	}
+	render_queue = xQueueCreate(queue_length, sizeof(render_cmd_t));
+	if (render_queue == NULL){
+		return false;
+	}
+	if (xTaskCreate(&RenderTask, "ILI9341", RENDER_TASK_STACK, NULL, priority, &render_task) != pdPASS){
+		vQueueDelete(render_queue);
+		render_queue = NULL;
+		return false;
+	}
+	return true;
+}
+
+void ILI9341AsyncFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	render_cmd_t cmd = {.id = RENDER_FILL, .foreground = color};
+
+	/* Stored normalized, so fills can be compared */
+	cmd.area.x0 = x0 < x1 ? x0 : x1;
+	cmd.area.x1 = x0 < x1 ? x1 : x0;
+	cmd.area.y0 = y0 < y1 ? y0 : y1;
+	cmd.area.y1 = y0 < y1 ? y1 : y0;
+	if (cmd.area.x1 >= lcd_orientation.width){
+		cmd.area.x1 = lcd_orientation.width - 1;
+	}
+	if (cmd.area.y1 >= lcd_orientation.height){
+		cmd.area.y1 = lcd_orientation.height - 1;
+	}
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncDrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	render_cmd_t cmd = {.id = RENDER_LINE, .area = {x0, y0, x1, y1}, .foreground = color};
+
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncDrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
+	render_cmd_t cmd = {.id = RENDER_STRING, .area = {x, y, x, y}, .font = font, .foreground = foreground, .background = background};
+
+	strncpy(cmd.text, str, ILI9341_ASYNC_TEXT_MAX - 1);
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncDrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
+	render_cmd_t cmd = {.id = RENDER_INT, .area = {x, y, x, y}, .value = num, .digits = dig, .font = font, .foreground = foreground, .background = background};
+
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncStripAdd(int32_t value){
+	render_cmd_t cmd = {.id = RENDER_STRIP, .value = value};
+
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncConsolePrint(char* str){
+	render_cmd_t cmd = {.id = RENDER_CONSOLE};
+
+	strncpy(cmd.text, str, ILI9341_ASYNC_TEXT_MAX - 1);
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncFlush(void){
+	render_cmd_t cmd = {.id = RENDER_FLUSH};
+
+	RenderPost(&cmd);
+}
+
+void ILI9341AsyncFence(void){
+	StaticSemaphore_t fence_buffer;
+	render_cmd_t cmd = {.id = RENDER_FENCE};
+
+	cmd.fence = xSemaphoreCreateBinaryStatic(&fence_buffer);
+	RenderPost(&cmd);
+	/* Commands are drawn in order: when the fence is reached, every previous one is done */
+	xSemaphoreTake(cmd.fence, portMAX_DELAY);
+	vSemaphoreDelete(cmd.fence);
+}
+
+void ILI9341AsyncDeInit(void){
+	if (render_queue == NULL){
+		return;
+	}
+	ILI9341AsyncFence();
+	vTaskDelete(render_task);
+	vQueueDelete(render_queue);
+	render_task = NULL;
+	render_queue = NULL;
+}
+
+void ILI9341GetStats(ili9341_stats_t *stats){
+	*stats = lcd_stats;
+}
+
+void ILI9341ResetStats(void){
+	lcd_stats.transactions = 0;
+	lcd_stats.bytes = 0;
+	lcd_stats.glyph_hits = 0;
+	lcd_stats.glyph_misses = 0;
+	lcd_stats.fills_coalesced = 0;
+}
+
+void ILI9341GlyphCacheInit(uint32_t budget){
+	ILI9341GlyphCacheDeInit();
+	glyph_cache.budget = budget;
+}
+
+void ILI9341GlyphCacheDeInit(void){
+	static uint8_t i;
+
+	for (i = 0; i < GLYPH_CACHE_SLOTS; i++){
+		if (glyph_cache.glyph[i].pixels != NULL){
+			heap_caps_free(glyph_cache.glyph[i].pixels);
+			glyph_cache.glyph[i].pixels = NULL;
+		}
+	}
+	glyph_cache.used = 0;
+	glyph_cache.budget = 0;
+}
+
+void ILI9341FramebufferDeInit(void){
+	if (framebuffer.data != NULL){
+		heap_caps_free(framebuffer.data);
+		framebuffer.data = NULL;
+	}
+	framebuffer.dirty_count = 0;
 }
 
 uint8_t ILI9341DeInit(void){
+	if (stream_buffer[0] != NULL){
+		SpiWaitQueue(ili9341_spi);
+		DmaBufferGive(stream_buffer[0]);
+		DmaBufferGive(stream_buffer[1]);
+		stream_buffer[0] = stream_buffer[1] = NULL;
+	}
 	return 0;
 }
 
@@ -0,0 +1,345 @@
+/**
+ * @file neopixel_effects.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "neopixel_effects.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define EFFECTS_STACK       2048
+#define EFFECTS_PRIORITY    5
+#define HUE_STEPS           256         // Entries of the rainbow color table
+#define HUE_SHIFT           16          // Rainbow hue accumulator: 8 bits of table index + 16 bits of fraction
+#define MAX_BRIGHT          255
+#define COLOR_OFF           0
+
+/**
+ * @brief Available effects
+ */
+typedef enum {
+	EFFECT_NONE,
+	EFFECT_RAINBOW,
+	EFFECT_CHASE,
+	EFFECT_FADE,
+	EFFECT_SPARKLE,
+} effect_t;
+
+/**
+ * @brief Effect selection, sent to the effects task
+ */
+typedef struct {
+	effect_t effect;
+	neopixel_color_t color;
+	uint16_t speed;
+	uint16_t size;
+	uint8_t sat;
+	uint8_t val;
+} effect_request_t;
+/*==================[internal data declaration]==============================*/
+static neopixel_effects_config_t effects;				/*!< Effects configuration */
+static TaskHandle_t effects_task = NULL;				/*!< Effects task */
+static QueueHandle_t effects_request = NULL;			/*!< Effect selected for the next frame */
+static effect_request_t current;						/*!< Effect running */
+static neopixel_effects_stats_t effects_stats;			/*!< Frame time statistics */
+static uint64_t effects_total_us = 0;					/*!< Sum of the frame times */
+static portMUX_TYPE effects_mux = portMUX_INITIALIZER_UNLOCKED;	/*!< Statistics are read from other tasks */
+
+static neopixel_color_t hue_table[HUE_STEPS];			/*!< Rainbow colors (fixed point HSV) */
+static uint32_t rainbow_hue = 0;						/*!< Hue of the first pixel */
+static uint32_t rainbow_step = 0;						/*!< Hue step between pixels */
+
+static uint16_t chase_pos = 0;							/*!< First pixel of the segment */
+
+static uint8_t fade_level = 0;							/*!< Brightness of the fade */
+static bool fade_up = true;								/*!< Fade direction */
+
+static uint16_t sparkle_lit[NEOPIXEL_SPARKLE_MAX];		/*!< Pixels lit on the last frame */
+static uint32_t sparkle_seed = 1;						/*!< Sparkle pseudo random generator state */
+/*==================[internal functions declaration]=========================*/
+static void NeoPixelEffectsTick(void *param);
+static void NeoPixelEffectsTask(void *param);
+static void NeoPixelEffectSetup(void);
+static void NeoPixelEffectStep(void);
+static void NeoPixelEffectRequest(effect_request_t *request);
+static void NeoPixelEffectsFill(neopixel_color_t color);
+static uint16_t NeoPixelEffectsRandom(void);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void NeoPixelEffectsTick(void *param){
+	vTaskNotifyGiveFromISR(effects_task, pdFALSE);
+}
+
+static void NeoPixelEffectsFill(neopixel_color_t color){
+	for(uint16_t i = 0; i < effects.len; i++){
+		effects.colors[i] = color;
+	}
+}
+
+static uint16_t NeoPixelEffectsRandom(void){
+	sparkle_seed ^= sparkle_seed << 13;
+	sparkle_seed ^= sparkle_seed >> 17;
+	sparkle_seed ^= sparkle_seed << 5;
+	/* Scaled to the stripe length without a divide */
+	return ((sparkle_seed & 0xFFFF) * effects.len) >> 16;
+}
+
+static void NeoPixelEffectSetup(void){
+	/* Runs once when the effect changes: everything per frame is a delta from here */
+	if(current.effect != EFFECT_FADE){
+		NeoPixelBrightness(MAX_BRIGHT);
+	}
+	switch(current.effect){
+		case EFFECT_RAINBOW:
+			for(uint16_t i = 0; i < HUE_STEPS; i++){
+				hue_table[i] = NeoPixelHSV2Color(i << 8, current.sat, current.val);
+			}
+			rainbow_step = ((uint32_t)current.size << (HUE_SHIFT + 8)) / effects.len;
+		break;
+		case EFFECT_CHASE:
+			NeoPixelEffectsFill(COLOR_OFF);
+			if(current.size > effects.len){
+				current.size = effects.len;
+			}
+			for(uint16_t i = 0; i < current.size; i++){
+				effects.colors[i] = current.color;
+			}
+			chase_pos = 0;
+		break;
+		case EFFECT_FADE:
+			NeoPixelEffectsFill(current.color);
+			if(current.speed == 0){
+				current.speed = 1;
+			}
+			fade_level = 0;
+			fade_up = true;
+			NeoPixelBrightness(fade_level);
+		break;
+		case EFFECT_SPARKLE:
+			NeoPixelEffectsFill(COLOR_OFF);
+			if(current.size > NEOPIXEL_SPARKLE_MAX){
+				current.size = NEOPIXEL_SPARKLE_MAX;
+			}
+			for(uint16_t i = 0; i < current.size; i++){
+				sparkle_lit[i] = 0;
+			}
+		break;
+		default:
+			NeoPixelEffectsFill(COLOR_OFF);
+		break;
+	}
+	NeoPixelSetArray(effects.colors);
+}
+
+static void NeoPixelEffectStep(void){
+	uint32_t hue;
+	uint16_t tail, head;
+	switch(current.effect){
+		case EFFECT_RAINBOW:
+			rainbow_hue += (uint32_t)current.speed << 8;
+			hue = rainbow_hue;
+			for(uint16_t i = 0; i < effects.len; i++){
+				effects.colors[i] = hue_table[(hue >> HUE_SHIFT) & (HUE_STEPS - 1)];
+				hue += rainbow_step;
+			}
+			NeoPixelSetArray(effects.colors);
+		break;
+		case EFFECT_CHASE:
+			if(current.size == 0 || current.size == effects.len){
+				break;
+			}
+			/* Only the pixels leaving and entering the segment change */
+			tail = chase_pos;
+			head = chase_pos + current.size;
+			if(head >= effects.len){
+				head -= effects.len;
+			}
+			effects.colors[tail] = COLOR_OFF;
+			effects.colors[head] = current.color;
+			chase_pos = (chase_pos + 1 < effects.len) ? chase_pos + 1 : 0;
+			NeoPixelSetArray(effects.colors);
+		break;
+		case EFFECT_FADE:
+			/* Colors stay, only the brightness table changes */
+			if(fade_up){
+				if(fade_level > MAX_BRIGHT - current.speed){
+					fade_level = MAX_BRIGHT;
+					fade_up = false;
+				}else{
+					fade_level += current.speed;
+				}
+			}else{
+				if(fade_level < current.speed){
+					fade_level = 0;
+					fade_up = true;
+				}else{
+					fade_level -= current.speed;
+				}
+			}
+			NeoPixelBrightness(fade_level);
+		break;
+		case EFFECT_SPARKLE:
+			for(uint16_t i = 0; i < current.size; i++){
+				effects.colors[sparkle_lit[i]] = COLOR_OFF;
+			}
+			for(uint16_t i = 0; i < current.size; i++){
+				sparkle_lit[i] = NeoPixelEffectsRandom();
+				effects.colors[sparkle_lit[i]] = current.color;
+			}
+			NeoPixelSetArray(effects.colors);
+		break;
+		default:
+		break;
+	}
+}
+
+static void NeoPixelEffectsTask(void *param){
+	effect_request_t request;
+	uint32_t ticks, frame_us;
+	int64_t start;
+	while(true){
+		ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(ticks > 1){
+			portENTER_CRITICAL(&effects_mux);
+			effects_stats.missed += ticks - 1;
+			portEXIT_CRITICAL(&effects_mux);
+		}
+		start = esp_timer_get_time();
+		if(xQueueReceive(effects_request, &request, 0) == pdTRUE){
+			current = request;
+			NeoPixelEffectSetup();
+		}else{
+			NeoPixelEffectStep();
+		}
+		NeoPixelShow();
+		frame_us = esp_timer_get_time() - start;
+		portENTER_CRITICAL(&effects_mux);
+		effects_stats.frames++;
+		effects_stats.last_us = frame_us;
+		if(frame_us > effects_stats.max_us){
+			effects_stats.max_us = frame_us;
+		}
+		effects_total_us += frame_us;
+		portEXIT_CRITICAL(&effects_mux);
+	}
+}
+
+static void NeoPixelEffectRequest(effect_request_t *request){
+	if(effects_request != NULL){
+		xQueueOverwrite(effects_request, request);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+uint8_t NeoPixelEffectsInit(neopixel_effects_config_t *config){
+	effect_request_t request = {
+		.effect = EFFECT_NONE,
+	};
+	if(config->colors == NULL || config->len == 0){
+		return 1;
+	}
+	effects = *config;
+	if(effects.fps == 0){
+		effects.fps = 1;
+	}
+	portENTER_CRITICAL(&effects_mux);
+	effects_stats = (neopixel_effects_stats_t){0};
+	effects_stats.period_us = 1000000 / effects.fps;
+	effects_total_us = 0;
+	portEXIT_CRITICAL(&effects_mux);
+	current = request;
+	NeoPixelAutoShow(false);
+	if(effects_request == NULL){
+		effects_request = xQueueCreate(1, sizeof(effect_request_t));
+		if(effects_request == NULL){
+			return 1;
+		}
+	}
+	if(effects_task == NULL){
+		if(xTaskCreate(&NeoPixelEffectsTask, "NEOPIXEL_FX", EFFECTS_STACK, NULL, EFFECTS_PRIORITY, &effects_task) != pdPASS){
+			effects_task = NULL;
+			return 1;
+		}
+	}
+	NeoPixelEffectRequest(&request);
+	timer_config_t timer = {
+		.timer = effects.timer,
+		.period = effects_stats.period_us,
+		.func_p = NeoPixelEffectsTick,
+		.param_p = NULL,
+	};
+	TimerInit(&timer);
+	return 0;
+}
+
+void NeoPixelEffectsStart(void){
+	TimerStart(effects.timer);
+}
+
+void NeoPixelEffectsStop(void){
+	TimerStop(effects.timer);
+}
+
+void NeoPixelEffectRainbow(uint16_t speed, uint8_t sat, uint8_t val, uint8_t reps){
+	effect_request_t request = {
+		.effect = EFFECT_RAINBOW,
+		.speed = speed,
+		.size = reps,
+		.sat = sat,
+		.val = val,
+	};
+	NeoPixelEffectRequest(&request);
+}
+
+void NeoPixelEffectChase(neopixel_color_t color, uint16_t size){
+	effect_request_t request = {
+		.effect = EFFECT_CHASE,
+		.color = color,
+		.size = size,
+	};
+	NeoPixelEffectRequest(&request);
+}
+
+void NeoPixelEffectFade(neopixel_color_t color, uint8_t speed){
+	effect_request_t request = {
+		.effect = EFFECT_FADE,
+		.color = color,
+		.speed = speed,
+	};
+	NeoPixelEffectRequest(&request);
+}
+
+void NeoPixelEffectSparkle(neopixel_color_t color, uint8_t qty){
+	effect_request_t request = {
+		.effect = EFFECT_SPARKLE,
+		.color = color,
+		.size = qty,
+	};
+	NeoPixelEffectRequest(&request);
+}
+
+void NeoPixelEffectsGetStats(neopixel_effects_stats_t *stats){
+	uint64_t total_us;
+	portENTER_CRITICAL(&effects_mux);
+	*stats = effects_stats;
+	total_us = effects_total_us;
+	portEXIT_CRITICAL(&effects_mux);
+	if(stats->frames != 0){
+		stats->avg_us = total_us / stats->frames;
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -12,6 +12,8 @@
 /*==================[inclusions]=============================================*/
 #include "neopixel_stripe.h"
 #include "ws2812b.h"
+#include <stddef.h>
+#include <string.h>
 /*==================[macros and definitions]=================================*/
 #define RED_MSK         0x00FF0000
 #define GREEN_MSK       0x0000FF00
@@ -25,24 +27,94 @@
 uint16_t stripe_length;
 uint8_t stripe_bright = MAX_BRIGHT;
 neopixel_color_t *stripe_colors; 
+static bool stripe_rmt = false;					/*!< Frames are sent by the RMT backend */
+static void (*stripe_func_p)(void *param) = NULL;	/*!< Frame done callback */
+static void *stripe_param_p = NULL;				/*!< Frame done callback parameter */
+static bool stripe_auto_show = true;			/*!< Each change is sent right away */
+static bool stripe_dirty = false;				/*!< stripe_colors changed since the last frame */
+static uint8_t stripe_levels[256];				/*!< Gamma corrected level of each color component at stripe_bright */
 /*==================[internal functions declaration]=========================*/
+static void NeoPixelSend(neopixel_color_t *color_array);
+static void NeoPixelUpdate(void);
+static void NeoPixelLevels(void);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void NeoPixelLevels(void){
+	/* Brightness and gamma in one lookup, rebuilt only when the brightness changes */
+	for (uint16_t i = 0; i < 256; i++){
+		stripe_levels[i] = ws2812bGammaCorrection((i * stripe_bright) >> BRIGHT_OFFSET);
+	}
+}
+
+static void NeoPixelSend(neopixel_color_t *color_array){
+	neopixel_color_t color;
+	if(stripe_rmt){
+		/* Convert the whole array into the back frame, the RMT sends it in background */
+		rgb_led_t *frame = ws2812bFrameBuffer();
+		for (uint16_t i = 0; i < stripe_length; i++){
+			color = color_array[i];
+			frame[i].green = stripe_levels[(uint8_t)(color >> GREEN_OFFSET)];
+			frame[i].red = stripe_levels[(uint8_t)(color >> RED_OFFSET)];
+			frame[i].blue = stripe_levels[(uint8_t)(color >> BLUE_OFFSET)];
+		}
+		ws2812bFrameSend(stripe_length, stripe_func_p, stripe_param_p);
+		return;
+	}
+	ws2812bSendRet();
+	ws2812bSendRet();
+	ws2812bSendRet();
+	for (uint16_t i = 0; i < stripe_length; i++){
+		color = color_array[i];
+		ws2812bSendWord(((uint32_t)stripe_levels[(uint8_t)(color >> GREEN_OFFSET)] << 16) | 
+						((uint32_t)stripe_levels[(uint8_t)(color >> RED_OFFSET)] << 8) | 
+						stripe_levels[(uint8_t)(color >> BLUE_OFFSET)]);
+	}
+	ws2812bSendRet();
+}
+
+static void NeoPixelUpdate(void){
+	if(stripe_auto_show){
+		NeoPixelSend(stripe_colors);
+		stripe_dirty = false;
+	}else{
+		stripe_dirty = true;
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
-    ws2812bInit(pin);
+	NeoPixelLevels();
+	/* The bit-banged output is kept for when the RMT is not available */
+	stripe_rmt = (ws2812bInitRmt(pin, len) == 0);
+	if(!stripe_rmt){
+		ws2812bInit(pin);
+	}
+}
+
+void NeoPixelFrameCallback(void (*func_p)(void *param), void *param_p){
+	stripe_func_p = func_p;
+	stripe_param_p = param_p;
 }
 
 void NeoPixelAllOff(void){
     rgb_led_t led;
+	if(stripe_rmt){
+		rgb_led_t *frame = ws2812bFrameBuffer();
+		for (uint16_t i = 0; i < stripe_length; i++){
+			frame[i].red = 0;
+			frame[i].green = 0;
+			frame[i].blue = 0;
+		}
+		ws2812bFrameSend(stripe_length, stripe_func_p, stripe_param_p);
+		return;
+	}
 	ws2812bSendRet();
 	ws2812bSendRet();
 	ws2812bSendRet();
@@ -59,30 +131,37 @@ void NeoPixelAllColor(neopixel_color_t color){
 	for (uint16_t i = 0; i < stripe_length; i++){
 		stripe_colors[i] = color;
 	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelUpdate();
 }
 
 void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
 	stripe_colors[pixel] = color;
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelUpdate();
 }
 
 void NeoPixelSetArray(neopixel_color_t *color_array){
-    rgb_led_t led;
-	uint16_t red, green, blue;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		red = ((color_array[i] & RED_MSK) >> RED_OFFSET) * stripe_bright;
-		green = ((color_array[i] & GREEN_MSK) >> GREEN_OFFSET) * stripe_bright;
-		blue = ((color_array[i] & BLUE_MSK) >> BLUE_OFFSET) * stripe_bright;
-		led.red = red >> BRIGHT_OFFSET;
-		led.green = green >> BRIGHT_OFFSET;
-		led.blue = blue >> BRIGHT_OFFSET;
-		ws2812bSend(led);
+	if(stripe_auto_show){
+		NeoPixelSend(color_array);
+		return;
+	}
+	if(color_array != stripe_colors){
+		memcpy(stripe_colors, color_array, stripe_length * sizeof(neopixel_color_t));
+	}
+	stripe_dirty = true;
+}
+
+void NeoPixelShow(void){
+	if(stripe_dirty){
+		NeoPixelSend(stripe_colors);
+		stripe_dirty = false;
+	}
+}
+
+void NeoPixelAutoShow(bool enable){
+	stripe_auto_show = enable;
+	if(enable){
+		NeoPixelShow();
 	}
-	ws2812bSendRet();
 }
 
 void NeoPixelShift(bool upwards){
@@ -101,12 +180,15 @@ void NeoPixelShift(bool upwards){
 		}
 		stripe_colors[stripe_length-1] = carry;
 	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelUpdate();
 }
 
 void NeoPixelBrightness(uint8_t bright){
-	stripe_bright = bright;
-	NeoPixelSetArray(stripe_colors);
+	if(bright != stripe_bright){
+		stripe_bright = bright;
+		NeoPixelLevels();
+	}
+	NeoPixelUpdate();
 }
 
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps){
@@ -115,7 +197,7 @@ void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps)
 		neopixel_color_t color = NeoPixelHSV2Color(hue, sat, val);
 		stripe_colors[i] = color;
   	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelUpdate();
 }
 
 neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue){
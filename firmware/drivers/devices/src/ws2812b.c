@@ -14,17 +14,59 @@
 #include "gpio_mcu.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "gpio_fast_out_mcu.h"
 #include "delay_mcu.h"
+#include "soc/soc_caps.h"
+#include "esp_heap_caps.h"
+#include "driver/rmt_tx.h"
 /*==================[macros and definitions]=================================*/
 #define RET_CMD (50)    // ret command 50us low
 #define BIT_0   (1)     // bit 0
 #define BIT_7   (1<<7)  // bit 0
+#define RMT_RESOLUTION_HZ   10000000    // RMT tick: 0.1us
+#define RMT_T0H             3           // bit 0: 0.3us high
+#define RMT_T0L             9           //        0.9us low
+#define RMT_T1H             9           // bit 1: 0.9us high
+#define RMT_T1L             3           //        0.3us low
+#define RMT_MEM_SYMBOLS     96          // RMT memory for the channel (ping-pong refill without DMA)
+#define RMT_QUEUE_SIZE      2           // Frames queued in the RMT driver
+#define FRAME_BUFFERS       2           // Frame buffers: one is sent while the other is filled
+#define NOP_DELAY(n)        __asm__ __volatile__(".rept " #n "\n\tnop\n\t.endr")
 /*==================[internal data declaration]==============================*/
 gpio_t pin_number;
-/*==================[internal functions declaration]=========================*/
+static uint8_t parallel_mask = 0;               /*!< Bundle bits of the parallel strips */
+static uint8_t parallel_qty = 0;                /*!< Qty of parallel strips */
 
+/**
+ * @brief Encoder for a whole frame: leds bits followed by the ret command
+ */
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encoder_t *bytes_encoder;
+    rmt_encoder_t *copy_encoder;
+    uint8_t state;
+    rmt_symbol_word_t ret_code;
+} ws2812b_encoder_t;
+
+static rmt_channel_handle_t rmt_channel = NULL;
+static ws2812b_encoder_t frame_encoder;
+static rgb_led_t *frame_buffer[FRAME_BUFFERS] = {NULL};    /*!< Frame buffers */
+static uint16_t frame_size = 0;                /*!< Frame buffer size (leds) */
+static uint8_t frame_back = 0;                 /*!< Frame buffer to be filled */
+static bool frame_back_taken = false;          /*!< Back frame buffer already free for filling */
+static uint8_t frame_done = 0;                 /*!< Next frame buffer to finish its transmission */
+static SemaphoreHandle_t frame_free = NULL;    /*!< Frame buffers not queued in the RMT */
+static void (*frame_func_p[FRAME_BUFFERS])(void *param) = {NULL};  /*!< Frame done callbacks */
+static void *frame_param_p[FRAME_BUFFERS] = {NULL};                /*!< Frame done callbacks parameters */
+/*==================[internal functions declaration]=========================*/
+void ws2812bSendHigh(gpio_t pin);
+void ws2812bSendLow(gpio_t pin);
+static void ws2812bSendPlane(uint8_t plane);
+static void ws2812bTranspose(const uint8_t *in, uint8_t *planes);
 /*==================[internal data definition]===============================*/
+/* Bit senders indexed by the bit value, so the bit loop has no branches */
+static void (*const send_bit[2])(gpio_t pin) = {ws2812bSendLow, ws2812bSendHigh};
 static const uint8_t gamma_table[256] = {
     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
     0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
@@ -326,46 +368,165 @@ void IRAM_ATTR ws2812bSendLow(gpio_t pin){
     __asm__ __volatile__ ("nop");   // 94
 }
 
+static size_t IRAM_ATTR ws2812bEncode(rmt_encoder_t *encoder, rmt_channel_handle_t channel, 
+                                      const void *data, size_t size, rmt_encode_state_t *ret_state){
+    ws2812b_encoder_t *frame = __containerof(encoder, ws2812b_encoder_t, base);
+    rmt_encode_state_t session = RMT_ENCODING_RESET;
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    size_t symbols = 0;
+    /* The encoder is called again from the RMT ISR each time the channel memory 
+     * has room, until the leds bits and the ret command are complete */
+    if(frame->state == 0){
+        symbols += frame->bytes_encoder->encode(frame->bytes_encoder, channel, data, size, &session);
+        if(session & RMT_ENCODING_COMPLETE){
+            frame->state = 1;
+        }
+        if(session & RMT_ENCODING_MEM_FULL){
+            *ret_state = RMT_ENCODING_MEM_FULL;
+            return symbols;
+        }
+    }
+    if(frame->state == 1){
+        symbols += frame->copy_encoder->encode(frame->copy_encoder, channel, &frame->ret_code, 
+                                               sizeof(frame->ret_code), &session);
+        if(session & RMT_ENCODING_COMPLETE){
+            frame->state = 0;
+            state |= RMT_ENCODING_COMPLETE;
+        }
+        if(session & RMT_ENCODING_MEM_FULL){
+            state |= RMT_ENCODING_MEM_FULL;
+        }
+    }
+    *ret_state = state;
+    return symbols;
+}
+
+static esp_err_t ws2812bEncoderReset(rmt_encoder_t *encoder){
+    ws2812b_encoder_t *frame = __containerof(encoder, ws2812b_encoder_t, base);
+    rmt_encoder_reset(frame->bytes_encoder);
+    rmt_encoder_reset(frame->copy_encoder);
+    frame->state = 0;
+    return ESP_OK;
+}
+
+static esp_err_t ws2812bEncoderDel(rmt_encoder_t *encoder){
+    ws2812b_encoder_t *frame = __containerof(encoder, ws2812b_encoder_t, base);
+    rmt_del_encoder(frame->bytes_encoder);
+    rmt_del_encoder(frame->copy_encoder);
+    return ESP_OK;
+}
+
+static bool IRAM_ATTR ws2812bFrameDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *ctx){
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    /* Frames finish in the order they were queued */
+    uint8_t done = frame_done;
+    frame_done = (frame_done + 1) % FRAME_BUFFERS;
+    xSemaphoreGiveFromISR(frame_free, &xHigherPriorityTaskWoken);
+    if(frame_func_p[done] != NULL){
+        frame_func_p[done](frame_param_p[done]);
+    }
+    return xHigherPriorityTaskWoken == pdTRUE;
+}
+
+/*==================[external functions definition]==========================*/
 uint8_t ws2812bGammaCorrection(uint8_t component){
     return gamma_table[component];
 }
 
-/*==================[external functions definition]==========================*/
+static void IRAM_ATTR ws2812bSendPlane(uint8_t plane){
+    /* Delays of ws2812bSendHigh()/ws2812bSendLow(): every strip goes high, the ones 
+     * sending a 0 go low after 27 nops and the rest after 27 + 75 = 102 (T1H). 
+     * T0L is 75 + 29 = 104 nops (105 in ws2812bSendLow()) */
+    GPIOFastWrite(parallel_mask);
+    NOP_DELAY(27);
+    GPIOFastWrite(plane);
+    NOP_DELAY(75);
+    GPIOFastWrite(0);
+    NOP_DELAY(29);
+}
+
+static void ws2812bTranspose(const uint8_t *in, uint8_t *planes){
+    /* 8x8 bit matrix transpose (Hacker's Delight): planes[j] has bit 7-j of 
+     * in[k] at bit k, so planes[0] holds the first bit sent to each strip */
+    uint32_t x, y, t;
+    x = ((uint32_t)in[7] << 24) | ((uint32_t)in[6] << 16) | ((uint32_t)in[5] << 8) | in[4];
+    y = ((uint32_t)in[3] << 24) | ((uint32_t)in[2] << 16) | ((uint32_t)in[1] << 8) | in[0];
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+    planes[0] = x >> 24;
+    planes[1] = x >> 16;
+    planes[2] = x >> 8;
+    planes[3] = x;
+    planes[4] = y >> 24;
+    planes[5] = y >> 16;
+    planes[6] = y >> 8;
+    planes[7] = y;
+}
 
 void ws2812bInit(gpio_t pin){
     pin_number = pin;
+    /* The bundle of the parallel strips is replaced */
+    parallel_qty = 0;
     GPIOFastInit(&pin, 1);
 }
 
-void ws2812bSend(rgb_led_t led_color){
-    uint8_t i;
-	// Blue
-	for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.green) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
+uint8_t ws2812bInitParallel(gpio_t *pins, uint8_t qty){
+    if(qty == 0 || qty > WS2812B_PARALLEL_MAX){
+        return 1;
     }
-	// Red
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.red) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
+    parallel_qty = qty;
+    parallel_mask = (1 << qty) - 1;
+    pin_number = pins[0];
+    GPIOFastInit(pins, qty);
+    return 0;
+}
+
+void ws2812bSendParallel(rgb_led_t *const strips[], uint16_t len){
+    uint8_t green[WS2812B_PARALLEL_MAX] = {0};
+    uint8_t red[WS2812B_PARALLEL_MAX] = {0};
+    uint8_t blue[WS2812B_PARALLEL_MAX] = {0};
+    uint8_t planes[24];
+    if(parallel_qty == 0){
+        return;
     }
-	// Green
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.blue) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
+    ws2812bSendRet();
+    for(uint16_t i = 0; i < len; i++){
+        /* Planes of the next led are ready before its first bit */
+        for(uint8_t k = 0; k < parallel_qty; k++){
+            green[k] = strips[k][i].green;
+            red[k] = strips[k][i].red;
+            blue[k] = strips[k][i].blue;
         }
-        else{
-            ws2812bSendLow(pin_number);
+        ws2812bTranspose(green, &planes[0]);
+        ws2812bTranspose(red, &planes[8]);
+        ws2812bTranspose(blue, &planes[16]);
+        for(uint8_t b = 0; b < 24; b++){
+            ws2812bSendPlane(planes[b]);
         }
     }
+    ws2812bSendRet();
+}
+
+void ws2812bSend(rgb_led_t led_color){
+    ws2812bSendWord(((uint32_t)ws2812bGammaCorrection(led_color.green) << 16) | 
+                    ((uint32_t)ws2812bGammaCorrection(led_color.red) << 8) | 
+                    ws2812bGammaCorrection(led_color.blue));
+}
+
+void IRAM_ATTR ws2812bSendWord(uint32_t grb){
+    for(uint8_t i = 0; i < 24; i++){
+        send_bit[(grb >> 23) & BIT_0](pin_number);
+        grb <<= 1;
+    }
 }
 
 void ws2812bSendRet(void){
@@ -373,4 +534,136 @@ void ws2812bSendRet(void){
     DelayUs(RET_CMD);
 }
 
+uint8_t ws2812bInitRmt(gpio_t pin, uint16_t max_leds){
+    rmt_tx_channel_config_t channel_config = {
+        .gpio_num = pin,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = RMT_RESOLUTION_HZ,
+        .mem_block_symbols = RMT_MEM_SYMBOLS,
+        .trans_queue_depth = RMT_QUEUE_SIZE,
+#if SOC_RMT_SUPPORT_DMA
+        .flags.with_dma = true,
+#endif
+    };
+    rmt_bytes_encoder_config_t bytes_config = {
+        .bit0 = {.level0 = 1, .duration0 = RMT_T0H, .level1 = 0, .duration1 = RMT_T0L},
+        .bit1 = {.level0 = 1, .duration0 = RMT_T1H, .level1 = 0, .duration1 = RMT_T1L},
+        .flags.msb_first = 1,
+    };
+    rmt_copy_encoder_config_t copy_config = {};
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = ws2812bFrameDone,
+    };
+
+    ws2812bDeInitRmt();
+    for(uint8_t i = 0; i < FRAME_BUFFERS; i++){
+        frame_buffer[i] = heap_caps_calloc(max_leds, sizeof(rgb_led_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        if(frame_buffer[i] == NULL){
+            ws2812bDeInitRmt();
+            return 1;
+        }
+    }
+    frame_free = xSemaphoreCreateCounting(FRAME_BUFFERS, FRAME_BUFFERS);
+    if(frame_free == NULL){
+        ws2812bDeInitRmt();
+        return 1;
+    }
+    frame_size = max_leds;
+    frame_back = 0;
+    frame_back_taken = false;
+    frame_done = 0;
+    frame_encoder.base.encode = ws2812bEncode;
+    frame_encoder.base.reset = ws2812bEncoderReset;
+    frame_encoder.base.del = ws2812bEncoderDel;
+    frame_encoder.state = 0;
+    /* Ret command: line low for RET_CMD us */
+    frame_encoder.ret_code.level0 = 0;
+    frame_encoder.ret_code.duration0 = RET_CMD * (RMT_RESOLUTION_HZ / 1000000) / 2;
+    frame_encoder.ret_code.level1 = 0;
+    frame_encoder.ret_code.duration1 = RET_CMD * (RMT_RESOLUTION_HZ / 1000000) / 2;
+    if(rmt_new_tx_channel(&channel_config, &rmt_channel) != ESP_OK){
+        rmt_channel = NULL;
+        ws2812bDeInitRmt();
+        return 1;
+    }
+    if(rmt_new_bytes_encoder(&bytes_config, &frame_encoder.bytes_encoder) != ESP_OK || 
+       rmt_new_copy_encoder(&copy_config, &frame_encoder.copy_encoder) != ESP_OK){
+        ws2812bDeInitRmt();
+        return 1;
+    }
+    rmt_tx_register_event_callbacks(rmt_channel, &callbacks, NULL);
+    rmt_enable(rmt_channel);
+    pin_number = pin;
+    return 0;
+}
+
+void ws2812bDeInitRmt(void){
+    if(rmt_channel != NULL){
+        rmt_tx_wait_all_done(rmt_channel, -1);
+        rmt_disable(rmt_channel);
+        rmt_del_channel(rmt_channel);
+        rmt_channel = NULL;
+    }
+    if(frame_encoder.bytes_encoder != NULL){
+        rmt_del_encoder(frame_encoder.bytes_encoder);
+        frame_encoder.bytes_encoder = NULL;
+    }
+    if(frame_encoder.copy_encoder != NULL){
+        rmt_del_encoder(frame_encoder.copy_encoder);
+        frame_encoder.copy_encoder = NULL;
+    }
+    for(uint8_t i = 0; i < FRAME_BUFFERS; i++){
+        heap_caps_free(frame_buffer[i]);
+        frame_buffer[i] = NULL;
+    }
+    if(frame_free != NULL){
+        vSemaphoreDelete(frame_free);
+        frame_free = NULL;
+    }
+    frame_size = 0;
+}
+
+rgb_led_t *ws2812bFrameBuffer(void){
+    if(rmt_channel == NULL){
+        return NULL;
+    }
+    if(!frame_back_taken){
+        /* Only waits when both buffers are queued in the RMT */
+        xSemaphoreTake(frame_free, portMAX_DELAY);
+        frame_back_taken = true;
+    }
+    return frame_buffer[frame_back];
+}
+
+void ws2812bFrameSend(uint16_t len, void (*func_p)(void *param), void *param_p){
+    rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+    if(rmt_channel == NULL || len == 0){
+        return;
+    }
+    if(len > frame_size){
+        len = frame_size;
+    }
+    if(!frame_back_taken){
+        xSemaphoreTake(frame_free, portMAX_DELAY);
+    }
+    frame_func_p[frame_back] = func_p;
+    frame_param_p[frame_back] = param_p;
+    if(rmt_transmit(rmt_channel, &frame_encoder.base, frame_buffer[frame_back], 
+                    len * sizeof(rgb_led_t), &transmit_config) != ESP_OK){
+        /* The buffer was not queued, it stays as the back buffer */
+        frame_back_taken = true;
+        return;
+    }
+    frame_back = (frame_back + 1) % FRAME_BUFFERS;
+    frame_back_taken = false;
+}
+
+void ws2812bFrameWait(void){
+    if(rmt_channel != NULL){
+        rmt_tx_wait_all_done(rmt_channel, -1);
+    }
+}
+
 /*==================[end of file]============================================*/
@@ -21,11 +21,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 16/10/2026 | Continuous (DMA) conversion of one or more channels					|
+ * | 16/10/2026 | Continuous mode samples written to multi-consumer ring buffers		|
+ * | 16/10/2026 | Calibrated block conversion through lookup tables						|
+ * | 16/10/2026 | Scan groups: several channels in one pattern, timestamped frames		|
+ * | 16/10/2026 | Timer driven waveform playback on the analog output					|
+ * | 16/10/2026 | Direct digital synthesis signal generator								|
+ * | 16/10/2026 | Analog output configuration: pin, rate and noise shaping				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
+#include "sample_ring_mcu.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -39,7 +48,27 @@ typedef enum adc_mode {
 	ADC_CONTINUOUS,			/*!< Continuous read */
 } adc_mode_t;
 
+typedef enum dac_wave_mode {
+	DAC_WAVE_ONCE,			/*!< Stop at the end of the buffer (unless another one is queued) */
+	DAC_WAVE_LOOP,			/*!< Repeat the buffer until another one is queued */
+} dac_wave_mode_t;
+
+typedef enum dac_mode {
+	DAC_8_BITS,				/*!< 8 bit output: 16 bit values are truncated */
+	DAC_NOISE_SHAPING,		/*!< 16 bit values with first order noise shaping (more than 8 effective bits when written at a steady rate) */
+	DAC_DITHER,				/*!< As DAC_NOISE_SHAPING, plus triangular dither to remove idle tones */
+} dac_mode_t;
+
+typedef enum dds_shape {
+	DDS_SINE,				/*!< Sine wave */
+	DDS_SQUARE,				/*!< Square wave (50% duty cycle) */
+	DDS_TRIANGLE,			/*!< Triangle wave */
+	DDS_SAWTOOTH,			/*!< Rising sawtooth wave */
+} dds_shape_t;
+
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+#define ADC_FULL_SCALE_MV	3300	/*!< Input voltage converted by AnalogRawToFloat() to 1.0 */
+#define ADC_FRAME_SAMPLES	240	/*!< Conversions in each continuous mode frame (shared by every channel of the pattern). Whole scans of 1 to 4 channels */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -50,39 +79,149 @@ typedef struct {
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
 	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint32_t sample_frec;	/*!< Sample frequency of each channel, in Hz (only for continuous mode). The total 
+							     rate (sample_frec * number of channels) is limited to 611Hz - 83.3kHz */
 } analog_input_config_t;	
 
+/**
+ * @brief Scan group config structure: channels converted in a single continuous pattern
+ */
+typedef struct {
+	uint8_t channels;		/*!< Channels of the group (bit mask, e.g. (1 << CH1) | (1 << CH2)) */
+	uint32_t sample_frec;	/*!< Sample frequency of each channel, in Hz */
+	void *func_p;			/*!< Pointer to callback function for each conversion frame (called from an interrupt) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_scan_config_t;
+
+/**
+ * @brief Analog output config structure
+ */
+typedef struct {
+	uint8_t pin;			/*!< GPIO of the sigma-delta output (DAC for the board's analog output) */
+	uint32_t sdm_rate;		/*!< Sigma-delta modulator rate (Hz, 0: 1MHz). Higher rates leave less ripple after the output filter */
+	dac_mode_t mode;		/*!< Resolution mode */
+} analog_output_config_t;
+
+/**
+ * @brief Analog output waveform config structure
+ */
+typedef struct {
+	const uint8_t *samples;	/*!< Samples to play (same scale as AnalogOutputWrite()). Must remain valid while played */
+	uint32_t length;		/*!< Number of samples */
+	uint32_t sample_rate;	/*!< Samples played per second (Hz), up to 10 MHz */
+	dac_wave_mode_t mode;	/*!< Behaviour at the end of the buffer */
+	void *func_p;			/*!< Pointer to callback function called at the end of each buffer (from an interrupt), or NULL */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_output_wave_t;
+
+/**
+ * @brief Signal generator (DDS) config structure
+ */
+typedef struct {
+	dds_shape_t shape;		/*!< Waveform */
+	float frequency;		/*!< Frequency (Hz), below sample_rate / 2. Start frequency if sweeping */
+	float amplitude;		/*!< Amplitude, from 0 to 1 (full scale of the analog output) */
+	uint32_t sample_rate;	/*!< Samples generated per second (Hz), up to 10 MHz */
+	bool interpolate;		/*!< Linear interpolation between sine table entries (lower distortion) */
+	float sweep_end;		/*!< Frequency at the end of a linear sweep (Hz), below sample_rate / 2 */
+	float sweep_time;		/*!< Duration of the sweep (s), at least one sample period. 0: no sweep. The sweep is repeated */
+} analog_output_dds_t;
+
+/**
+ * @brief Frame of a scan group, de-interleaved per channel
+ */
+typedef struct {
+	int64_t timestamp;				/*!< Time of the first sample of the frame (us since boot) */
+	uint32_t sample_frec;			/*!< Sample frequency of each channel, in Hz */
+	uint8_t channels;				/*!< Channels with samples in the frame (bit mask) */
+	uint16_t count;					/*!< Samples of each channel (complete scans only, the same for every channel) */
+	uint16_t *samples[4];			/*!< Raw samples of each channel (NULL if not in the group). Valid until the next read */
+} analog_scan_frame_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Analog input initialization
  * 
+ * @note In continuous mode every initialized channel is added to a single conversion 
+ * pattern, so the channels are sampled interleaved at the same rate. The last non zero 
+ * sample_frec and the last non NULL func_p are used. func_p is called from an interrupt 
+ * each time a frame of ADC_FRAME_SAMPLES conversions is ready.
+ * 
  * @param config Analog inputs config structure
  * @return null
  */
 void AnalogInputInit(analog_input_config_t *config);
 
 /**
- * @brief Analog output initialization (DAC)
+ * @brief Analog output initialization (DAC), on the DAC pin at 1MHz with 8 bit resolution
  * 
  * @return null
  */
 void AnalogOutputInit(void);
 
+/**
+ * @brief Analog output initialization (DAC) with the corresponding configuration
+ * 
+ * @note The noise shaping modes only add resolution when AnalogOutputWrite16() is called 
+ * at a steady rate well above the signal bandwidth, as the signal generator does. 
+ * tools/sdm_dac_model.py estimates the SNR of each configuration.
+ * 
+ * @param config Analog output config structure
+ * @return uint8_t 0 on success, 1 if the sigma-delta channel can not be created
+ */
+uint8_t AnalogOutputInitConfig(analog_output_config_t *config);
+
 /**
  * @brief Read single channel.
  * 
  * @param channel Channel selected
- * @param value Read variable pointer (in mV)
+ * @param value Read variable pointer (raw value, see AnalogRawToMv())
  * @return null
  */
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 
+/**
+ * @brief Build the raw value to mV lookup table of a channel from its calibration curve
+ * 
+ * @note Uses 8kB of RAM per channel. Must be called once before AnalogRawToMv() or 
+ * AnalogRawToFloat(), for channels in single or continuous mode.
+ * 
+ * @param channel Channel selected
+ * @return uint8_t 0 on success, 1 if the calibration curve or the table can not be created
+ */
+uint8_t AnalogInputCalibrate(adc_ch_t channel);
+
+/**
+ * @brief Convert a block of raw values of a channel to calibrated mV
+ * 
+ * @param channel Channel selected (calibrated with AnalogInputCalibrate(). If it is not, 
+ * raw values are scaled linearly to ADC_FULL_SCALE_MV, without calibration)
+ * @param raw Raw values
+ * @param mv Converted values, in mV (can be the same array as raw)
+ * @param count Number of values
+ */
+void AnalogRawToMv(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint32_t count);
+
+/**
+ * @brief Convert a block of raw values of a channel to calibrated, normalized float 
+ * (ADC_FULL_SCALE_MV is 1.0), ready for the signal processing functions
+ * 
+ * @param channel Channel selected (calibrated with AnalogInputCalibrate(). If it is not, 
+ * raw values are scaled linearly to ADC_FULL_SCALE_MV, without calibration)
+ * @param raw Raw values
+ * @param values Converted values
+ * @param count Number of values
+ */
+void AnalogRawToFloat(adc_ch_t channel, const uint16_t *raw, float *values, uint32_t count);
+
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * @note Conversions are transferred by DMA. Every channel initialized in continuous 
+ * mode is started, regardless of the channel selected.
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -90,17 +229,58 @@ void AnalogStartContinuous(adc_ch_t channel);
 /**
  * @brief Stop convertion for ADC module
  * 
+ * @note Every channel of the continuous mode pattern is stopped.
+ * 
  * @param channel Channel selected
  */
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the samples of a channel from the last conversion frame (raw values)
+ * 
+ * @note When every sample of the channel has already been read, the next frame stored 
+ * by the driver is read and the samples of the other channels are replaced. Call it for 
+ * every channel of the pattern after each frame callback.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (ADC_FRAME_SAMPLES elements)
+ * @return uint16_t number of samples copied (0 if no frame is available)
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Configure several channels as one continuous conversion pattern (scan group)
+ * 
+ * @note Channels of the group are converted one after the other, so the samples of the 
+ * same index of each channel are taken 1/(sample_frec * channels) apart instead of a full 
+ * task cycle. Replaces the channels previously initialized in continuous mode. Start the 
+ * conversion with AnalogStartContinuous().
+ * 
+ * @param config Scan group config structure
+ * @return uint8_t 0 on success, 1 if no channel is selected or a conversion is running
+ */
+uint8_t AnalogScanInit(analog_scan_config_t *config);
+
+/**
+ * @brief Read the next conversion frame of the scan group
+ * 
+ * @param frame Frame with the samples of each channel aligned by index
+ * @return uint16_t samples of each channel (0 if no frame is available)
+ */
+uint16_t AnalogScanRead(analog_scan_frame_t *frame);
+
+/**
+ * @brief Write the samples of a channel to a ring buffer, from the conversion frame interrupt
+ * 
+ * @note The ring must hold uint16_t samples (raw values) and keep at least a few frames. 
+ * Several tasks can read it, each one with its own sample_ring_reader_t. Must be called 
+ * while continuous conversion is stopped.
+ * 
+ * @param channel Channel selected
+ * @param ring Ring buffer (NULL to detach it)
+ * @return uint8_t 0 on success, 1 if conversion is running or the ring is not of uint16_t
+ */
+uint8_t AnalogInputRingAttach(adc_ch_t channel, sample_ring_t *ring);
 
 /**
  * @brief Digital-to-Analog convert.
@@ -109,6 +289,73 @@ void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
  */
 void AnalogOutputWrite(uint8_t value);
 
+/**
+ * @brief Digital-to-Analog convert with the resolution mode of AnalogOutputInitConfig().
+ * 
+ * @param value Digital value to convert (from 0 to 65535)
+ */
+void AnalogOutputWrite16(uint16_t value);
+
+/**
+ * @brief Start playing a waveform on the analog output
+ * 
+ * @note Each sample is written from a timer interrupt, so no task runs during playback. 
+ * AnalogOutputInit() must be called first.
+ * 
+ * @param wave Waveform config structure
+ * @return uint8_t 0 on success, 1 if the parameters are not valid or the timer is not available
+ */
+uint8_t AnalogOutputWaveStart(analog_output_wave_t *wave);
+
+/**
+ * @brief Queue the next buffer to be played right after the current one (streaming)
+ * 
+ * @note Only one buffer can be queued. The callback of the waveform tells when the 
+ * queued buffer started to play, so the previous one can be refilled (ping-pong).
+ * 
+ * @param samples Samples to play. Must remain valid while played
+ * @param length Number of samples
+ * @return true if the buffer was queued, false if playback is stopped or a buffer is already queued
+ */
+bool AnalogOutputWaveQueue(const uint8_t *samples, uint32_t length);
+
+/**
+ * @brief Stop waveform playback. The output keeps the last sample written.
+ */
+void AnalogOutputWaveStop(void);
+
+/**
+ * @brief Start the signal generator on the analog output
+ * 
+ * @note A phase accumulator advances a fixed amount on each timer interrupt and the 
+ * sample is taken from a quarter wave sine table (or computed for square, triangle and 
+ * sawtooth waves), so the interrupt cost does not depend on the frequency. Frequency 
+ * resolution is far below 1 Hz. Replaces any waveform being played.
+ * 
+ * @param dds Signal generator config structure
+ * @return uint8_t 0 on success, 1 if the parameters are not valid or the timer is not available
+ */
+uint8_t AnalogOutputDdsStart(analog_output_dds_t *dds);
+
+/**
+ * @brief Change the frequency of the signal generator without phase discontinuity
+ * 
+ * @param frequency New frequency (Hz). Ignored if negative or not below half the sample rate
+ */
+void AnalogOutputDdsSetFrequency(float frequency);
+
+/**
+ * @brief Stop the signal generator. The output keeps the last sample written.
+ */
+void AnalogOutputDdsStop(void);
+
+/**
+ * @brief Check if a waveform is being played
+ * 
+ * @return true if playback is running
+ */
+bool AnalogOutputWaveRunning(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,122 @@
+#ifndef DMA_POOL_MCU_H
+#define DMA_POOL_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup DMA_POOL DMA_POOL
+ ** @{ */
+
+/** \brief Pool of DMA capable buffers shared by the drivers.
+ *
+ * All buffers have the same size and are allocated at once in DMA capable, aligned 
+ * internal RAM. Drivers take buffers from the pool, fill them in place and give them 
+ * back once the transfer that uses them has ended, so no bounce copies are needed and 
+ * the RAM used by the drivers is bounded by the size of the pool.
+ * 
+ * @note If DmaPoolInit() is not called, the first DmaBufferTake() creates a pool of 
+ * DMA_POOL_BUFFER_QTY buffers of DMA_POOL_BUFFER_SIZE bytes: the two the LCD keeps 
+ * while it is in use and two for other drivers, whichever takes first. Call it before 
+ * initializing the drivers to reserve more (or fewer) buffers, and use DmaPoolGetStats() 
+ * to size it.
+ * 
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define DMA_POOL_BUFFER_SIZE	4092	/*!< Default size of each buffer (one full SPI DMA transaction) */
+#define DMA_POOL_BUFFER_QTY		4		/*!< Default number of buffers (LCD stream buffers and two more for other drivers) */
+#define DMA_POOL_ALIGNMENT		4		/*!< Alignment of each buffer (bytes) */
+#define DMA_POOL_NO_WAIT		0		/*!< DmaBufferTake() returns NULL right away if the pool is empty */
+#define DMA_POOL_WAIT_FOREVER	0xFFFFFFFF	/*!< DmaBufferTake() waits until a buffer is given back */
+
+/*==================[typedef]================================================*/
+
+/**
+ * @brief DMA pool usage counters
+ */
+typedef struct{
+	uint32_t buffer_size;	/*!< Size of each buffer (bytes) */
+	uint8_t buffer_qty;		/*!< Number of buffers in the pool */
+	uint8_t in_use;			/*!< Buffers currently lent */
+	uint8_t max_in_use;		/*!< Maximum number of buffers lent at the same time */
+	uint32_t takes;			/*!< Buffers lent */
+	uint32_t failures;		/*!< Requests that found the pool empty */
+} dma_pool_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+
+/**
+ * @brief Allocate the pool of DMA buffers
+ * 
+ * @note Can only be called once, before any buffer is taken.
+ * 
+ * @param buffer_size size of each buffer (bytes), rounded up to DMA_POOL_ALIGNMENT
+ * @param buffer_qty number of buffers
+ * @return uint8_t 0 on success, 1 if the pool already exists or there is not enough memory
+ */
+uint8_t DmaPoolInit(uint32_t buffer_size, uint8_t buffer_qty);
+
+/**
+ * @brief Take a buffer from the pool
+ * 
+ * @param wait_ms time to wait for a buffer to be given back (DMA_POOL_NO_WAIT or 
+ * DMA_POOL_WAIT_FOREVER are accepted)
+ * @return uint8_t* buffer of DmaBufferSize() bytes, or NULL if the pool is empty
+ */
+uint8_t* DmaBufferTake(uint32_t wait_ms);
+
+/**
+ * @brief Give a buffer back to the pool
+ * 
+ * @param buffer buffer obtained from DmaBufferTake()
+ */
+void DmaBufferGive(uint8_t* buffer);
+
+/**
+ * @brief Give a buffer back to the pool from an interrupt (e.g. a transfer end callback)
+ * 
+ * @param buffer buffer obtained from DmaBufferTake()
+ */
+void DmaBufferGiveFromISR(uint8_t* buffer);
+
+/**
+ * @brief Size of the buffers of the pool
+ * 
+ * @return uint32_t size of each buffer (bytes), 0 if the pool was not created
+ */
+uint32_t DmaBufferSize(void);
+
+/**
+ * @brief Check if a buffer belongs to the pool
+ * 
+ * @param buffer pointer to check
+ * @return true if buffer is the start of one of the buffers of the pool
+ */
+bool DmaBufferIsPooled(const void* buffer);
+
+/**
+ * @brief Read the usage counters of the pool
+ * 
+ * @param stats structure where counters are copied
+ */
+void DmaPoolGetStats(dma_pool_stats_t* stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif 
+
+/*==================[end of file]============================================*/
@@ -16,6 +16,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 16/10/2026 | Write mask covers every pin of the bundle							|
  * 
  **/
 
@@ -23,7 +24,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "gpio_mcu.h"
+#include "soc/soc_caps.h"
 /*==================[macros]=================================================*/
+#define GPIO_FAST_MAX   SOC_DEDIC_GPIO_OUT_CHANNELS_NUM      /*> Max qty of pins in the bundle (dedicated output channels, 8 on the ESP32-C6) */
 
 /*==================[typedef]================================================*/
 
@@ -32,17 +35,18 @@
 /*==================[external functions declaration]=========================*/
 
 /**
- * @brief 
+ * @brief Set a group of pins as outputs written at once by GPIOFastWrite().
  * 
- * @param pin_list 
- * @param pin_qty 
+ * @note Replaces the group set by a previous call.
+ * @param pin_list  List of GPIO numbers, pin_list[i] is written with bit i
+ * @param pin_qty   Qty of pins (up to GPIO_FAST_MAX)
  */
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
 
 /**
- * @brief 
+ * @brief Write every pin of the group.
  * 
- * @param value 
+ * @param value Bit i is the level of pin_list[i]
  */
 void GPIOFastWrite(uint16_t value);
 
@@ -0,0 +1,150 @@
+#ifndef SAMPLE_RING_MCU_H
+#define SAMPLE_RING_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Sample_Ring Sample Ring
+ ** @{ */
+
+/** \brief Lock-free ring buffer of samples with one producer and several consumers.
+ *
+ * The producer (e.g. the ADC frame interrupt) writes samples without waiting for the 
+ * consumers. Each consumer has its own read cursor (sample_ring_reader_t) and reads the 
+ * samples in place, as contiguous spans of the ring, so a block is never copied once per 
+ * consumer. A consumer that falls more than the capacity of the ring behind the producer 
+ * loses the oldest samples: the loss is detected and counted per consumer.
+ * 
+ * @note Samples can be of any size (uint16_t, float, ...), fixed for each ring.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Ring buffer of samples
+ */
+typedef struct {
+	uint8_t *data;				/*!< Samples */
+	uint32_t capacity;			/*!< Number of samples (power of 2) */
+	uint8_t sample_size;		/*!< Size of each sample (bytes) */
+	volatile uint32_t head;		/*!< Number of samples written since initialization */
+} sample_ring_t;
+
+/**
+ * @brief Read cursor of a consumer
+ */
+typedef struct {
+	uint32_t tail;				/*!< Number of samples read since initialization */
+	uint32_t overruns;			/*!< Times the producer overwrote samples not read yet */
+	uint32_t lost;				/*!< Samples overwritten before being read */
+} sample_ring_reader_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Allocate a ring buffer
+ * 
+ * @param ring Ring buffer
+ * @param capacity Number of samples (rounded up to a power of 2)
+ * @param sample_size Size of each sample (bytes)
+ * @return uint8_t 0 on success, 1 if there is not enough memory
+ */
+uint8_t SampleRingInit(sample_ring_t *ring, uint32_t capacity, uint8_t sample_size);
+
+/**
+ * @brief Free the memory of a ring buffer
+ * 
+ * @note No producer or consumer can use the ring anymore.
+ * 
+ * @param ring Ring buffer
+ */
+void SampleRingDeInit(sample_ring_t *ring);
+
+/**
+ * @brief Write samples (producer). Can be called from an interrupt.
+ * 
+ * @param ring Ring buffer
+ * @param samples Samples to write
+ * @param count Number of samples
+ */
+void SampleRingWrite(sample_ring_t *ring, const void *samples, uint32_t count);
+
+/**
+ * @brief Get the contiguous free space at the write position (producer), to write 
+ * samples in place
+ * 
+ * @param ring Ring buffer
+ * @param span Pointer to the first sample to write
+ * @return uint32_t Number of samples that can be written before the end of the ring
+ */
+uint32_t SampleRingWriteSpan(sample_ring_t *ring, void **span);
+
+/**
+ * @brief Publish samples written in place (producer). Can be called from an interrupt.
+ * 
+ * @param ring Ring buffer
+ * @param count Number of samples written (up to the value returned by SampleRingWriteSpan())
+ */
+void SampleRingCommit(sample_ring_t *ring, uint32_t count);
+
+/**
+ * @brief Initialize a consumer cursor. The consumer will read samples written from now on.
+ * 
+ * @param ring Ring buffer
+ * @param reader Consumer cursor
+ */
+void SampleRingReaderInit(sample_ring_t *ring, sample_ring_reader_t *reader);
+
+/**
+ * @brief Number of samples not read yet by a consumer
+ * 
+ * @param ring Ring buffer
+ * @param reader Consumer cursor
+ * @return uint32_t Samples available (up to the capacity of the ring)
+ */
+uint32_t SampleRingAvailable(sample_ring_t *ring, sample_ring_reader_t *reader);
+
+/**
+ * @brief Get the oldest contiguous samples not read yet by a consumer, without copying them
+ * 
+ * @note If the producer overwrote samples not read yet, the cursor skips them and the 
+ * overrun is counted.
+ * 
+ * @param ring Ring buffer
+ * @param reader Consumer cursor
+ * @param span Pointer to the first sample
+ * @return uint32_t Number of contiguous samples (0 if there are none)
+ */
+uint32_t SampleRingPeek(sample_ring_t *ring, sample_ring_reader_t *reader, const void **span);
+
+/**
+ * @brief Mark samples obtained with SampleRingPeek() as read
+ * 
+ * @param ring Ring buffer
+ * @param reader Consumer cursor
+ * @param count Number of samples read
+ * @return true if the samples were still valid, false if the producer overwrote them 
+ * while they were being read (the overrun is counted)
+ */
+bool SampleRingRelease(sample_ring_t *ring, sample_ring_reader_t *reader, uint32_t count);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif 
+
+/*==================[end of file]============================================*/
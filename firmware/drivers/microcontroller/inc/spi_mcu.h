@@ -21,12 +21,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 16/10/2026 | Queued (DMA) transactions and pre-transaction callback				|
+ * | 16/10/2026 | Per-device configuration, queued reads and bus acquisition			|
+ * | 16/10/2026 | Queued writes of buffers lent by the DMA pool							|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_SIZE	8		/*!< Maximum number of queued transactions per device */
+#define SPI_MAX_TRANSFER_SIZE	4092	/*!< Maximum number of bytes in a single DMA transaction */
 
 /*==================[typedef]================================================*/
 
@@ -68,6 +73,8 @@ typedef struct{
 	transfer_mode_t transfer_mode;	/*!< Transfer mode */
 	void *func_p;					/*!< Pointer to callback function for transaction end */
 	void *param_p;					/*!< Pointer to callback parameter */
+	void *pre_func_p;				/*!< Pointer to function called before each transaction starts (receives the transaction user tag) */
+	uint8_t queue_size;				/*!< Number of transactions that can be queued (0 or more than SPI_QUEUE_SIZE: SPI_QUEUE_SIZE) */
 } spi_mcu_config_t;
 /*==================[external data declaration]==============================*/
 
@@ -75,14 +82,19 @@ typedef struct{
 /**
  * @brief Initialize SPI module with the corresponding configuration
  * 
+ * @note Each device keeps its own clock, mode, transfer mode and callbacks. Calling it 
+ * again for an already configured device replaces its configuration.
+ * 
  * @param spi Structure with the module configuration
- * @return uint8_t 
+ * @return uint8_t 0 on success, 1 if the device could not be added to the bus
  */
 uint8_t SpiInit(spi_mcu_config_t* spi);
 
 /**
  * @brief Read data from SPI port
  * 
+ * @note Blocking transfers first wait for the queued transactions of the device to end.
+ * 
  * @param device SPI device to read from
  * @param rx_buffer pointer to buffer where data is stored
  * @param rx_buffer_size numbers of bytes to read
@@ -108,11 +120,100 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue data to be written through SPI port, without waiting for the transfer to end
+ * 
+ * @note Transfers are done by DMA. Buffers of up to 4 bytes are copied, so they can be 
+ * reused right away. Bigger buffers must remain unchanged until SpiWaitQueue() returns.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored
+ * @param tx_buffer_size numbers of bytes to write
+ * @param user tag passed to pre_func_p when the transaction starts
+ */
+void SpiQueueWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size, void * user);
+
+/**
+ * @brief Queue a buffer of the DMA pool to be written through SPI port, without waiting 
+ * for the transfer to end
+ * 
+ * @note The buffer is owned by the driver from now on: it is given back to the pool when 
+ * the transaction ends, so it must not be used or given back by the caller.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer buffer obtained from DmaBufferTake() with the data to write
+ * @param tx_buffer_size numbers of bytes to write
+ * @param user tag passed to pre_func_p when the transaction starts
+ */
+void SpiQueueWritePooled(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size, void * user);
+
+/**
+ * @brief Queue data to be read through SPI port, without waiting for the transfer to end
+ * 
+ * @note rx_buffer must be DMA capable and is valid once SpiWaitQueue() or SpiWaitPending() 
+ * have released the transaction.
+ * 
+ * @param device SPI device to read from
+ * @param rx_buffer pointer to buffer where data is stored
+ * @param rx_buffer_size numbers of bytes to read
+ * @param user tag passed to pre_func_p when the transaction starts
+ */
+void SpiQueueRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size, void * user);
+
+/**
+ * @brief Queue data to be written and read simultaneous through SPI port, without waiting 
+ * for the transfer to end
+ * 
+ * @param device SPI device
+ * @param tx_buffer pointer to buffer where data to write is stored
+ * @param rx_buffer pointer to buffer where data read is stored
+ * @param buffer_size numbers of bytes to read or write
+ * @param user tag passed to pre_func_p when the transaction starts
+ */
+void SpiQueueReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size, void * user);
+
+/**
+ * @brief Wait until all queued transactions of a device are finished
+ * 
+ * @param device SPI device
+ */
+void SpiWaitQueue(spi_dev_t device);
+
+/**
+ * @brief Wait until no more than a given number of queued transactions remain in flight
+ * 
+ * @note Transactions finish in the order they were queued, so after this call every
+ * buffer except the last "pending" ones can be reused.
+ * 
+ * @param device SPI device
+ * @param pending number of transactions that can remain in flight
+ */
+void SpiWaitPending(spi_dev_t device, uint8_t pending);
+
+/**
+ * @brief Reserve the SPI bus for a device
+ * 
+ * @note Transactions of other devices wait until SpiReleaseBus() is called, so a burst of 
+ * transactions is sent back to back. Keep bursts short when the bus is shared.
+ * 
+ * @param device SPI device
+ */
+void SpiAcquireBus(spi_dev_t device);
+
+/**
+ * @brief Release the SPI bus reserved with SpiAcquireBus()
+ * 
+ * @param device SPI device
+ */
+void SpiReleaseBus(spi_dev_t device);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
+ * @note Waits for the queued transactions of the device and removes it from the bus.
+ * 
  * @param device SPI device 
- * @return uint8_t 
+ * @return uint8_t 0 on success, 1 if the device was not initialized
  */
 uint8_t SpiDeInit(spi_dev_t device);
 
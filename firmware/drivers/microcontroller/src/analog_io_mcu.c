@@ -11,6 +11,13 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include "sample_ring_mcu.h"
+#include <string.h>
+#include <math.h>
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
@@ -19,15 +26,66 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CH_QTY			4							// Number of analog inputs
+#define ADC_FRAME_BYTES		(ADC_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES)	// Size of a conversion frame
+#define ADC_STORE_FRAMES	4							// Conversion frames stored by the driver until they are read
+#define ADC_RAW_QTY			(1 << ADC_BITWIDTH)			// Number of possible raw values
+#define ADC_STAMP_QTY		(2 * ADC_STORE_FRAMES)		// End of frame timestamps kept until the frame is read (power of 2)
+#define DAC_TIMER_RES_HZ	10000000					// Resolution of the waveform playback timer (also the maximum sample rate)
+#define DAC_DEFAULT_PIN		0							// Analog output pin (shared with CH0)
+#define DAC_DEFAULT_RATE	1000000						// Sigma-delta modulator rate (Hz)
+#define DDS_SINE_BITS		8							// log2 of the entries of the quarter wave sine table
+#define DDS_SINE_QTY		(1 << DDS_SINE_BITS)		// Entries of the quarter wave sine table
+#define DDS_FULL_SCALE		32767						// Peak value of the generated waveforms
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+adc_cali_handle_t adc_calibration[ADC_CH_QTY];			/*!< Calibration curve of each channel */
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc1_cont = NULL;
 sdm_channel_handle_t dac = NULL;
+gptimer_handle_t dac_timer = NULL;
 bool adc1_single_used = false;
+bool adc1_cont_running = false;
+uint8_t adc_cont_channels = 0;							/*!< Channels of the conversion pattern (bit mask) */
+uint32_t adc_cont_frec = 0;								/*!< Sample frequency of each channel (Hz) */
+void (*adc_cont_isr_p)(void*) = NULL;					/*!< Callback function for each conversion frame */
+void *adc_cont_user_data;								/*!< Callback function parameter */
+static uint8_t adc_frame[ADC_FRAME_BYTES];				/*!< Last conversion frame read */
+static uint16_t adc_cont_values[ADC_CH_QTY][ADC_FRAME_SAMPLES];	/*!< Samples of the last frame, per channel */
+static uint16_t adc_cont_count[ADC_CH_QTY];			/*!< Samples of the last frame not read yet, per channel */
+static sample_ring_t *adc_cont_ring[ADC_CH_QTY];		/*!< Ring buffer fed from the frame interrupt, per channel */
+static uint8_t adc_cont_rings = 0;						/*!< Number of channels with a ring buffer */
+static uint16_t *adc_mv_lut[ADC_CH_QTY];				/*!< Raw value to mV lookup table, per channel */
+static int64_t adc_frame_stamp[ADC_STAMP_QTY];			/*!< Time at the end of each stored frame (us) */
+static volatile uint32_t adc_stamp_head = 0;			/*!< Timestamps written (frame interrupt) */
+static uint32_t adc_stamp_tail = 0;						/*!< Timestamps read */
+static int64_t adc_last_stamp;							/*!< Time at the first sample of the last frame read (us) */
+static const uint8_t *volatile dac_wave;				/*!< Buffer being played */
+static volatile uint32_t dac_wave_len;					/*!< Samples of the buffer being played */
+static volatile uint32_t dac_wave_pos;					/*!< Next sample to play */
+static const uint8_t *volatile dac_wave_next = NULL;	/*!< Buffer queued to be played after the current one */
+static volatile uint32_t dac_wave_next_len;				/*!< Samples of the queued buffer */
+static dac_wave_mode_t dac_wave_mode;					/*!< Behaviour at the end of a buffer with nothing queued */
+static volatile bool dac_wave_running = false;			/*!< Waveform playback running */
+static dac_mode_t dac_mode = DAC_8_BITS;				/*!< Resolution mode of the analog output */
+static int32_t dac_error = 0;							/*!< Quantization error fed back to the next sample (noise shaping) */
+static uint32_t dac_dither_seed = 1;					/*!< Dither pseudo random generator state */
+static void (*dac_wave_isr_p)(void*) = NULL;			/*!< Callback function for each buffer played */
+static void *dac_wave_user_data;						/*!< Callback function parameter */
+static int16_t dds_sine[DDS_SINE_QTY + 1];				/*!< First quarter of a sine wave (one extra entry for interpolation) */
+static volatile bool dds_running = false;				/*!< Signal generator running (instead of waveform playback) */
+static dds_shape_t dds_shape;							/*!< Generated waveform */
+static bool dds_interpolate;							/*!< Interpolate between sine table entries */
+static int32_t dds_gain;								/*!< Amplitude (Q15) */
+static uint32_t dds_phase;								/*!< Phase accumulator (2^32 is a full cycle) */
+static volatile uint64_t dds_step;						/*!< Phase increment per sample (Q32.32 of the 32 bit phase) */
+static uint64_t dds_sweep_start, dds_sweep_end;			/*!< Phase increments at the start and end of the sweep */
+static int64_t dds_sweep_delta;							/*!< Phase increment change per sample (0: no sweep) */
+static uint32_t dds_rate;								/*!< Samples generated per second */
+static portMUX_TYPE dds_mux = portMUX_INITIALIZER_UNLOCKED;	/*!< dds_step is 64 bits: written with the ISR masked */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+const adc_channel_t adc_channel[ADC_CH_QTY] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
 adc_oneshot_unit_init_cfg_t init_config_single = {
 	.unit_id = ADC_UNIT_1,
 	.ulp_mode = ADC_ULP_MODE_DISABLE,
@@ -39,6 +97,263 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static bool IRAM_ATTR AdcFrameDone(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	uint32_t head[ADC_CH_QTY];
+	adc_digi_output_data_t *result;
+	sample_ring_t *ring;
+	if(adc_cont_rings){
+		for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+			if(adc_cont_ring[ch] != NULL){
+				head[ch] = adc_cont_ring[ch]->head;
+			}
+		}
+		/* Samples are de-interleaved straight into the ring of their channel */
+		for(uint32_t i = 0; i < edata->size; i += SOC_ADC_DIGI_RESULT_BYTES){
+			result = (adc_digi_output_data_t*)&edata->conv_frame_buffer[i];
+			if(result->type2.channel < ADC_CH_QTY && (ring = adc_cont_ring[result->type2.channel]) != NULL){
+				((uint16_t*)ring->data)[head[result->type2.channel]++ & (ring->capacity - 1)] = result->type2.data;
+			}
+		}
+		for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+			if(adc_cont_ring[ch] != NULL){
+				SampleRingCommit(adc_cont_ring[ch], head[ch] - adc_cont_ring[ch]->head);
+			}
+		}
+	}
+	/* The frame is stored by the driver after this callback */
+	adc_frame_stamp[adc_stamp_head & (ADC_STAMP_QTY - 1)] = esp_timer_get_time();
+	adc_stamp_head++;
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_user_data);
+	}
+	return false;
+}
+
+static bool IRAM_ATTR AdcPoolOverflow(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	/* The last frame could not be stored: its timestamp is discarded */
+	adc_stamp_head--;
+	return false;
+}
+
+static inline void IRAM_ATTR DacWrite(uint8_t value){
+	sdm_channel_set_pulse_density(dac, (int8_t)(value - 128));
+}
+
+static inline int32_t IRAM_ATTR DacDither(void){
+	/* Triangular dither of +-1 output step, from two xorshift samples */
+	dac_dither_seed ^= dac_dither_seed << 13;
+	dac_dither_seed ^= dac_dither_seed >> 17;
+	dac_dither_seed ^= dac_dither_seed << 5;
+	return (int32_t)(dac_dither_seed & 0xFF) + (int32_t)((dac_dither_seed >> 8) & 0xFF) - 255;
+}
+
+static inline void IRAM_ATTR DacWrite16(uint16_t value){
+	int32_t shaped, level;
+	if(dac_mode == DAC_8_BITS){
+		DacWrite(value >> 8);
+		return;
+	}
+	/* First order error feedback: the quantization error of each sample is added to the 
+	 * next one, so it moves to high frequencies and is removed by the output filter */
+	shaped = value + dac_error;
+	level = shaped;
+	if(dac_mode == DAC_DITHER){
+		level += DacDither();
+	}
+	level = (level + 128) >> 8;
+	level = level < 0 ? 0 : (level > 255 ? 255 : level);
+	dac_error = shaped - (level << 8);
+	/* Near full scale the error can not be compensated */
+	dac_error = dac_error < -256 ? -256 : (dac_error > 256 ? 256 : dac_error);
+	DacWrite(level);
+}
+
+static bool IRAM_ATTR DacWaveTick(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	DacWrite(dac_wave[dac_wave_pos]);
+	if(++dac_wave_pos < dac_wave_len){
+		return false;
+	}
+	/* End of buffer: the queued one starts on the next tick, without a gap */
+	dac_wave_pos = 0;
+	if(dac_wave_next != NULL){
+		dac_wave = dac_wave_next;
+		dac_wave_len = dac_wave_next_len;
+		dac_wave_next = NULL;
+	} else if(dac_wave_mode == DAC_WAVE_ONCE){
+		gptimer_stop(timer);
+		dac_wave_running = false;
+	}
+	if(dac_wave_isr_p != NULL){
+		dac_wave_isr_p(dac_wave_user_data);
+	}
+	return false;
+}
+
+static inline int32_t IRAM_ATTR DdsSine(uint32_t phase){
+	/* Bits 31-30: quadrant, next DDS_SINE_BITS: table entry, the rest: fraction between entries */
+	uint32_t index = (phase >> (30 - DDS_SINE_BITS)) & (DDS_SINE_QTY - 1);
+	uint32_t frac = (phase >> (14 - DDS_SINE_BITS)) & 0xFFFF;
+	int32_t a, b, value;
+	if(phase & 0x40000000){
+		/* 2nd and 4th quadrants run the table backwards */
+		index = DDS_SINE_QTY - index;
+		a = dds_sine[index];
+		b = dds_sine[index - 1];
+	} else{
+		a = dds_sine[index];
+		b = dds_sine[index + 1];
+	}
+	value = dds_interpolate ? a + (((b - a) * (int32_t)frac) >> 16) : a;
+	return (phase & 0x80000000) ? -value : value;
+}
+
+static inline void IRAM_ATTR DdsTick(void){
+	int32_t value = 0;
+	switch(dds_shape){
+		case DDS_SINE:
+			value = DdsSine(dds_phase);
+		break;
+		case DDS_SQUARE:
+			value = (dds_phase & 0x80000000) ? -DDS_FULL_SCALE : DDS_FULL_SCALE;
+		break;
+		case DDS_TRIANGLE:
+			/* Shifted a quarter of cycle to start at 0 and rising, like the sine */
+			value = (int32_t)((dds_phase + 0xC0000000) >> 15) - 65536;
+			value = (value < 0 ? -value : value) - 32768;
+			value = value > DDS_FULL_SCALE ? DDS_FULL_SCALE : value;
+		break;
+		case DDS_SAWTOOTH:
+			value = (int32_t)(dds_phase >> 16) - 32768;
+		break;
+	}
+	DacWrite16(32768 + ((value * dds_gain) >> 15));
+	dds_phase += (uint32_t)(dds_step >> 32);
+	if(dds_sweep_delta != 0){
+		dds_step += dds_sweep_delta;
+		/* The sweep starts again when the end frequency is crossed */
+		if((dds_sweep_delta > 0 && dds_step >= dds_sweep_end) || (dds_sweep_delta < 0 && dds_step <= dds_sweep_end)){
+			dds_step = dds_sweep_start;
+		}
+	}
+}
+
+static bool IRAM_ATTR DacTimerTick(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	if(dds_running){
+		DdsTick();
+		return false;
+	}
+	return DacWaveTick(timer, edata, user_data);
+}
+
+static uint64_t DdsStep(float frequency){
+	/* 32 extra fractional bits keep the small per-sample changes of slow sweeps */
+	return (uint64_t)((double)frequency / dds_rate * 4294967296.0 * 4294967296.0);
+}
+
+static uint8_t DacTimerInit(uint32_t sample_rate){
+	/* At least one timer count per sample */
+	if(sample_rate == 0 || sample_rate > DAC_TIMER_RES_HZ){
+		return 1;
+	}
+	if(dac_timer == NULL){
+		gptimer_config_t timer_config = {
+			.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+			.direction = GPTIMER_COUNT_UP,
+			.resolution_hz = DAC_TIMER_RES_HZ,
+		};
+		if(gptimer_new_timer(&timer_config, &dac_timer) != ESP_OK){
+			return 1;
+		}
+		gptimer_event_callbacks_t cbs = {
+			.on_alarm = DacTimerTick,
+		};
+		gptimer_register_event_callbacks(dac_timer, &cbs, NULL);
+		gptimer_enable(dac_timer);
+	}
+	AnalogOutputWaveStop();
+	gptimer_alarm_config_t alarm_config = {
+		.alarm_count = DAC_TIMER_RES_HZ / sample_rate,
+		.reload_count = 0,
+		.flags.auto_reload_on_alarm = true,
+	};
+	gptimer_set_alarm_action(dac_timer, &alarm_config);
+	gptimer_set_raw_count(dac_timer, 0);
+	return 0;
+}
+
+static uint32_t AdcPatternFrec(void){
+	uint8_t pattern_num = 0;
+	uint32_t frec;
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		if(adc_cont_channels & (1 << ch)){
+			pattern_num++;
+		}
+	}
+	/* Channels of the pattern are converted one after the other */
+	frec = adc_cont_frec * pattern_num;
+	if(frec < SOC_ADC_SAMPLE_FREQ_THRES_LOW){
+		frec = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+	}
+	if(frec > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+		frec = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+	}
+	return frec;
+}
+
+static void AdcReadFrame(void){
+	uint32_t length = 0;
+	adc_digi_output_data_t *result;
+	memset(adc_cont_count, 0, sizeof(adc_cont_count));
+	if(adc_continuous_read(adc1_cont, adc_frame, ADC_FRAME_BYTES, &length, 0) != ESP_OK){
+		return;
+	}
+	/* Samples of every channel of the pattern are interleaved in the frame. If conversions 
+	 * were lost the frame may not start at a scan: skip up to the first channel of the pattern */
+	uint32_t i = 0;
+	uint8_t first_ch = __builtin_ctz(adc_cont_channels | (1 << ADC_CH_QTY));
+	while(i < length && ((adc_digi_output_data_t*)&adc_frame[i])->type2.channel != first_ch){
+		i += SOC_ADC_DIGI_RESULT_BYTES;
+	}
+	for(; i < length; i += SOC_ADC_DIGI_RESULT_BYTES){
+		result = (adc_digi_output_data_t*)&adc_frame[i];
+		if(result->type2.channel < ADC_CH_QTY){
+			adc_cont_values[result->type2.channel][adc_cont_count[result->type2.channel]++] = result->type2.data;
+		}
+	}
+	/* Frames are read in the order they were stored; older timestamps may have been overwritten */
+	if(adc_stamp_head - adc_stamp_tail > ADC_STAMP_QTY){
+		adc_stamp_tail = adc_stamp_head - ADC_STAMP_QTY;
+	}
+	if(adc_stamp_tail != adc_stamp_head){
+		adc_last_stamp = adc_frame_stamp[adc_stamp_tail & (ADC_STAMP_QTY - 1)];
+		adc_stamp_tail++;
+	} else{
+		adc_last_stamp = esp_timer_get_time();
+	}
+	adc_last_stamp -= (int64_t)length / SOC_ADC_DIGI_RESULT_BYTES * 1000000 / AdcPatternFrec();
+}
+
+static void AdcContinuousConfig(void){
+	adc_digi_pattern_config_t pattern[ADC_CH_QTY];
+	uint8_t pattern_num = 0;
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		if(adc_cont_channels & (1 << ch)){
+			pattern[pattern_num].atten = ADC_ATTENUATION;
+			pattern[pattern_num].channel = adc_channel[ch];
+			pattern[pattern_num].unit = ADC_UNIT_1;
+			pattern[pattern_num].bit_width = ADC_BITWIDTH;
+			pattern_num++;
+		}
+	}
+	adc_continuous_config_t cont_config = {
+		.pattern_num = pattern_num,
+		.adc_pattern = pattern,
+		.sample_freq_hz = AdcPatternFrec(),
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc1_cont, &cont_config));
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -61,7 +376,7 @@ void AnalogInputInit(analog_input_config_t *config){
 						.atten = ADC_ATTENUATION,
 						.bitwidth = ADC_BITWIDTH,
 					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
+					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration[CH0]));
 				break;
 				case CH1:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
@@ -72,7 +387,7 @@ void AnalogInputInit(analog_input_config_t *config){
 						.atten = ADC_ATTENUATION,
 						.bitwidth = ADC_BITWIDTH,
 					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
+					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration[CH1]));
 				break;
 				case CH2:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
@@ -83,7 +398,7 @@ void AnalogInputInit(analog_input_config_t *config){
 						.atten = ADC_ATTENUATION,
 						.bitwidth = ADC_BITWIDTH,
 					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
+					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration[CH2]));
 				break;
 				case CH3:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
@@ -94,71 +409,354 @@ void AnalogInputInit(analog_input_config_t *config){
 						.atten = ADC_ATTENUATION,
 						.bitwidth = ADC_BITWIDTH,
 					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
+					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration[CH3]));
 				break;
 			}
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			if(adc1_cont == NULL){
+				adc_continuous_handle_cfg_t handle_config = {
+					.max_store_buf_size = ADC_FRAME_BYTES * ADC_STORE_FRAMES,
+					.conv_frame_size = ADC_FRAME_BYTES,
+				};
+				ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc1_cont));
+				adc_continuous_evt_cbs_t cbs = {
+					.on_conv_done = AdcFrameDone,
+					.on_pool_ovf = AdcPoolOverflow,
+				};
+				ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc1_cont, &cbs, NULL));
+			}
+			/* Every channel is added to the same conversion pattern */
+			adc_cont_channels |= 1 << config->input;
+			if(config->sample_frec != 0){
+				adc_cont_frec = config->sample_frec;
+			}
+			if(config->func_p != NULL){
+				adc_cont_isr_p = config->func_p;
+				adc_cont_user_data = config->param_p;
 			}
 		break;
 	}
 }
 
 void AnalogOutputInit(void){
+	analog_output_config_t config = {
+		.pin = DAC_DEFAULT_PIN,
+		.sdm_rate = DAC_DEFAULT_RATE,
+		.mode = DAC_8_BITS,
+	};
+	AnalogOutputInitConfig(&config);
+}
+
+uint8_t AnalogOutputInitConfig(analog_output_config_t *config){
 	sdm_config_t dac_config = {
 		.clk_src = SDM_CLK_SRC_DEFAULT,
-		.sample_rate_hz = 1 * 1000 * 1000,
-		.gpio_num = 0,
+		.sample_rate_hz = config->sdm_rate != 0 ? config->sdm_rate : DAC_DEFAULT_RATE,
+		.gpio_num = config->pin,
 	};
-	sdm_new_channel(&dac_config, &dac);
+	if(dac != NULL){
+		AnalogOutputWaveStop();
+		sdm_channel_disable(dac);
+		sdm_del_channel(dac);
+		dac = NULL;
+	}
+	if(sdm_new_channel(&dac_config, &dac) != ESP_OK){
+		dac = NULL;
+		return 1;
+	}
+	dac_mode = config->mode;
+	dac_error = 0;
 	sdm_channel_enable(dac);
+	return 0;
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
+	int raw = 0;
+	/* adc_oneshot_read() writes an int, value only holds 16 bits */
+	adc_oneshot_read(adc1_single, adc_channel[channel], &raw);
+	*value = raw;
+}
+
+uint8_t AnalogInputCalibrate(adc_ch_t channel){
+	int mv;
+	if(adc_mv_lut[channel] != NULL){
+		return 0;
+	}
+	if(adc_calibration[channel] == NULL){
+		adc_cali_curve_fitting_config_t cali_config = {
+			.unit_id = ADC_UNIT_1,
+			.chan = adc_channel[channel],
+			.atten = ADC_ATTENUATION,
+			.bitwidth = ADC_BITWIDTH,
+		};
+		if(adc_cali_create_scheme_curve_fitting(&cali_config, &adc_calibration[channel]) != ESP_OK){
+			return 1;
+		}
+	}
+	adc_mv_lut[channel] = heap_caps_malloc(ADC_RAW_QTY * sizeof(uint16_t), MALLOC_CAP_INTERNAL);
+	if(adc_mv_lut[channel] == NULL){
+		return 1;
+	}
+	/* The calibration curve is evaluated once for every possible raw value */
+	for(uint32_t raw = 0; raw < ADC_RAW_QTY; raw++){
+		adc_cali_raw_to_voltage(adc_calibration[channel], raw, &mv);
+		adc_mv_lut[channel][raw] = mv;
 	}
+	return 0;
 }
 
-void AnalogStartContinuous(adc_ch_t channel){
+void AnalogRawToMv(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint32_t count){
+	const uint16_t *lut;
+	uint32_t i = 0;
+	if(channel >= ADC_CH_QTY){
+		return;
+	}
+	lut = adc_mv_lut[channel];
+	if(lut == NULL){
+		/* Not calibrated: raw values scaled to the full scale */
+		for(; i < count; i++){
+			mv[i] = ((uint32_t)(raw[i] & (ADC_RAW_QTY - 1)) * ADC_FULL_SCALE_MV) / (ADC_RAW_QTY - 1);
+		}
+		return;
+	}
+	for(; i + 4 <= count; i += 4){
+		mv[i] = lut[raw[i] & (ADC_RAW_QTY - 1)];
+		mv[i + 1] = lut[raw[i + 1] & (ADC_RAW_QTY - 1)];
+		mv[i + 2] = lut[raw[i + 2] & (ADC_RAW_QTY - 1)];
+		mv[i + 3] = lut[raw[i + 3] & (ADC_RAW_QTY - 1)];
+	}
+	for(; i < count; i++){
+		mv[i] = lut[raw[i] & (ADC_RAW_QTY - 1)];
+	}
+}
 
+void AnalogRawToFloat(adc_ch_t channel, const uint16_t *raw, float *values, uint32_t count){
+	const uint16_t *lut;
+	const float scale = 1.0f / ADC_FULL_SCALE_MV;
+	uint32_t i = 0;
+	if(channel >= ADC_CH_QTY){
+		return;
+	}
+	lut = adc_mv_lut[channel];
+	if(lut == NULL){
+		/* Not calibrated: raw values scaled to the full scale */
+		for(; i < count; i++){
+			values[i] = (raw[i] & (ADC_RAW_QTY - 1)) * (1.0f / (ADC_RAW_QTY - 1));
+		}
+		return;
+	}
+	for(; i + 4 <= count; i += 4){
+		values[i] = lut[raw[i] & (ADC_RAW_QTY - 1)] * scale;
+		values[i + 1] = lut[raw[i + 1] & (ADC_RAW_QTY - 1)] * scale;
+		values[i + 2] = lut[raw[i + 2] & (ADC_RAW_QTY - 1)] * scale;
+		values[i + 3] = lut[raw[i + 3] & (ADC_RAW_QTY - 1)] * scale;
+	}
+	for(; i < count; i++){
+		values[i] = lut[raw[i] & (ADC_RAW_QTY - 1)] * scale;
+	}
+}
+
+void AnalogStartContinuous(adc_ch_t channel){
+	if(adc1_cont == NULL || adc1_cont_running){
+		return;
+	}
+	AdcContinuousConfig();
+	memset(adc_cont_count, 0, sizeof(adc_cont_count));
+	adc_stamp_tail = adc_stamp_head;
+	ESP_ERROR_CHECK(adc_continuous_start(adc1_cont));
+	adc1_cont_running = true;
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	if(!adc1_cont_running){
+		return;
+	}
+	ESP_ERROR_CHECK(adc_continuous_stop(adc1_cont));
+	adc1_cont_running = false;
+}
 
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	uint16_t count;
+	if(!adc1_cont_running){
+		return 0;
+	}
+	if(adc_cont_count[channel] == 0){
+		AdcReadFrame();
+	}
+	count = adc_cont_count[channel];
+	memcpy(values, adc_cont_values[channel], count * sizeof(uint16_t));
+	adc_cont_count[channel] = 0;
+	return count;
+}
+
+uint8_t AnalogScanInit(analog_scan_config_t *config){
+	analog_input_config_t input = {
+		.mode = ADC_CONTINUOUS,
+		.func_p = config->func_p,
+		.param_p = config->param_p,
+		.sample_frec = config->sample_frec,
+	};
+	/* An empty pattern can not be started */
+	if(adc1_cont_running || (config->channels & ((1 << ADC_CH_QTY) - 1)) == 0){
+		return 1;
+	}
+	/* The group replaces the previous conversion pattern */
+	adc_cont_channels = 0;
+	adc_cont_isr_p = NULL;
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		if(config->channels & (1 << ch)){
+			input.input = ch;
+			AnalogInputInit(&input);
+		}
+	}
+	return 0;
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+uint16_t AnalogScanRead(analog_scan_frame_t *frame){
+	if(!adc1_cont_running){
+		return 0;
+	}
+	AdcReadFrame();
+	frame->timestamp = adc_last_stamp;
+	frame->channels = adc_cont_channels;
+	if(frame->channels == 0){
+		frame->sample_frec = 0;
+		frame->count = 0;
+		return 0;
+	}
+	frame->sample_frec = AdcPatternFrec() / __builtin_popcount(adc_cont_channels);
+	frame->count = ADC_FRAME_SAMPLES;
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		frame->samples[ch] = NULL;
+		if(adc_cont_channels & (1 << ch)){
+			frame->samples[ch] = adc_cont_values[ch];
+			/* Only complete scans: index i is the same scan in every channel */
+			if(adc_cont_count[ch] < frame->count){
+				frame->count = adc_cont_count[ch];
+			}
+			adc_cont_count[ch] = 0;
+		}
+	}
+	return frame->count;
+}
 
+uint8_t AnalogInputRingAttach(adc_ch_t channel, sample_ring_t *ring){
+	if(adc1_cont_running || (ring != NULL && ring->sample_size != sizeof(uint16_t))){
+		return 1;
+	}
+	if(adc_cont_ring[channel] != NULL){
+		adc_cont_rings--;
+	}
+	adc_cont_ring[channel] = ring;
+	if(ring != NULL){
+		adc_cont_rings++;
+	}
+	return 0;
 }
 
 void AnalogOutputWrite(uint8_t value){
-	int8_t density = value - 128;
-	sdm_channel_set_pulse_density(dac, density);
+	DacWrite(value);
+}
+
+void AnalogOutputWrite16(uint16_t value){
+	DacWrite16(value);
+}
+
+uint8_t AnalogOutputWaveStart(analog_output_wave_t *wave){
+	if(dac == NULL || wave->samples == NULL || wave->length == 0 || wave->sample_rate == 0){
+		return 1;
+	}
+	if(DacTimerInit(wave->sample_rate) != 0){
+		return 1;
+	}
+	dac_wave = wave->samples;
+	dac_wave_len = wave->length;
+	dac_wave_pos = 0;
+	dac_wave_next = NULL;
+	dac_wave_mode = wave->mode;
+	dac_wave_isr_p = wave->func_p;
+	dac_wave_user_data = wave->param_p;
+	dac_wave_running = true;
+	gptimer_start(dac_timer);
+	return 0;
+}
+
+bool AnalogOutputWaveQueue(const uint8_t *samples, uint32_t length){
+	if(!dac_wave_running || dac_wave_next != NULL || length == 0){
+		return false;
+	}
+	/* The length must be valid before the timer interrupt sees the buffer */
+	dac_wave_next_len = length;
+	dac_wave_next = samples;
+	return true;
+}
+
+void AnalogOutputWaveStop(void){
+	if(dac_wave_running || dds_running){
+		gptimer_stop(dac_timer);
+		dac_wave_running = false;
+		dds_running = false;
+	}
+	dac_wave_next = NULL;
+}
+
+uint8_t AnalogOutputDdsStart(analog_output_dds_t *dds){
+	if(dac == NULL || dds->sample_rate == 0 || dds->frequency < 0){
+		return 1;
+	}
+	if(DacTimerInit(dds->sample_rate) != 0){
+		return 1;
+	}
+	if(dds_sine[DDS_SINE_QTY] == 0){
+		for(uint16_t i = 0; i <= DDS_SINE_QTY; i++){
+			dds_sine[i] = DDS_FULL_SCALE * sinf((float)M_PI / 2 * i / DDS_SINE_QTY);
+		}
+	}
+	dds_rate = DAC_TIMER_RES_HZ / (DAC_TIMER_RES_HZ / dds->sample_rate);
+	/* Frequencies must be below half the sample rate (the step would not fit in 64 bits) */
+	if(dds->frequency >= dds_rate / 2.0f || (dds->sweep_time > 0 && dds->sweep_end >= dds_rate / 2.0f)){
+		return 1;
+	}
+	/* A sweep lasts at least one sample (the sweep step is divided by its samples) */
+	if(dds->sweep_time > 0 && dds->sweep_time * dds_rate < 1.0f){
+		return 1;
+	}
+	dds_shape = dds->shape;
+	dds_interpolate = dds->interpolate;
+	dds_gain = dds->amplitude >= 1.0f ? 32768 : (dds->amplitude <= 0 ? 0 : dds->amplitude * 32768);
+	dds_phase = 0;
+	portENTER_CRITICAL(&dds_mux);
+	dds_sweep_start = DdsStep(dds->frequency);
+	dds_step = dds_sweep_start;
+	dds_sweep_delta = 0;
+	if(dds->sweep_time > 0 && dds->sweep_end >= 0){
+		dds_sweep_end = DdsStep(dds->sweep_end);
+		dds_sweep_delta = ((int64_t)(dds_sweep_end >> 1) - (int64_t)(dds_sweep_start >> 1)) / (int64_t)(dds->sweep_time * dds_rate) * 2;
+	}
+	portEXIT_CRITICAL(&dds_mux);
+	dds_running = true;
+	gptimer_start(dac_timer);
+	return 0;
+}
+
+void AnalogOutputDdsSetFrequency(float frequency){
+	uint64_t step;
+	if(frequency < 0 || dds_rate == 0 || frequency >= dds_rate / 2.0f){
+		return;
+	}
+	step = DdsStep(frequency);
+	/* A sweep keeps running from the new frequency */
+	portENTER_CRITICAL(&dds_mux);
+	dds_step = step;
+	portEXIT_CRITICAL(&dds_mux);
+}
+
+void AnalogOutputDdsStop(void){
+	AnalogOutputWaveStop();
+}
+
+bool AnalogOutputWaveRunning(void){
+	return dac_wave_running;
 }
 
 /** @} doxygen end group definition */
@@ -0,0 +1,135 @@
+/**
+ * @file dma_pool_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "dma_pool_mcu.h"
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+static uint8_t *pool_data = NULL;		/*!< Memory of every buffer of the pool */
+static QueueHandle_t pool_free = NULL;	/*!< Buffers available to be taken */
+static dma_pool_stats_t pool_stats;		/*!< Usage counters */
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;	/*!< Protects the usage counters */
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+uint8_t DmaPoolInit(uint32_t buffer_size, uint8_t buffer_qty){
+    uint8_t *buffer;
+    if(pool_data != NULL || buffer_qty == 0){
+        return 1;
+    }
+    buffer_size = (buffer_size + DMA_POOL_ALIGNMENT - 1) & ~(DMA_POOL_ALIGNMENT - 1);
+    pool_data = heap_caps_aligned_alloc(DMA_POOL_ALIGNMENT, buffer_size * buffer_qty, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    pool_free = xQueueCreate(buffer_qty, sizeof(uint8_t*));
+    if(pool_data == NULL || pool_free == NULL){
+        if(pool_data != NULL){
+            heap_caps_free(pool_data);
+            pool_data = NULL;
+        }
+        if(pool_free != NULL){
+            vQueueDelete(pool_free);
+            pool_free = NULL;
+        }
+        return 1;
+    }
+    for(uint8_t i = 0; i < buffer_qty; i++){
+        buffer = &pool_data[i * buffer_size];
+        xQueueSend(pool_free, &buffer, 0);
+    }
+    pool_stats.buffer_size = buffer_size;
+    pool_stats.buffer_qty = buffer_qty;
+    pool_stats.in_use = 0;
+    pool_stats.max_in_use = 0;
+    pool_stats.takes = 0;
+    pool_stats.failures = 0;
+    return 0;
+}
+
+uint8_t* DmaBufferTake(uint32_t wait_ms){
+    uint8_t *buffer;
+    TickType_t wait;
+    if(pool_free == NULL){
+        if(DmaPoolInit(DMA_POOL_BUFFER_SIZE, DMA_POOL_BUFFER_QTY) != 0){
+            return NULL;
+        }
+    }
+    wait = (wait_ms == DMA_POOL_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms);
+    if(xQueueReceive(pool_free, &buffer, wait) != pdTRUE){
+        portENTER_CRITICAL(&pool_lock);
+        pool_stats.failures++;
+        portEXIT_CRITICAL(&pool_lock);
+        return NULL;
+    }
+    portENTER_CRITICAL(&pool_lock);
+    pool_stats.takes++;
+    pool_stats.in_use++;
+    if(pool_stats.in_use > pool_stats.max_in_use){
+        pool_stats.max_in_use = pool_stats.in_use;
+    }
+    portEXIT_CRITICAL(&pool_lock);
+    return buffer;
+}
+
+void DmaBufferGive(uint8_t* buffer){
+    if(!DmaBufferIsPooled(buffer)){
+        return;
+    }
+    portENTER_CRITICAL(&pool_lock);
+    pool_stats.in_use--;
+    portEXIT_CRITICAL(&pool_lock);
+    xQueueSend(pool_free, &buffer, 0);
+}
+
+void IRAM_ATTR DmaBufferGiveFromISR(uint8_t* buffer){
+    BaseType_t task_woken = pdFALSE;
+    if(!DmaBufferIsPooled(buffer)){
+        return;
+    }
+    portENTER_CRITICAL_ISR(&pool_lock);
+    pool_stats.in_use--;
+    portEXIT_CRITICAL_ISR(&pool_lock);
+    xQueueSendFromISR(pool_free, &buffer, &task_woken);
+    if(task_woken){
+        portYIELD_FROM_ISR();
+    }
+}
+
+uint32_t DmaBufferSize(void){
+    return pool_stats.buffer_size;
+}
+
+bool IRAM_ATTR DmaBufferIsPooled(const void* buffer){
+    const uint8_t *p = buffer;
+    if(pool_data == NULL || p < pool_data || p >= pool_data + pool_stats.buffer_size * pool_stats.buffer_qty){
+        return false;
+    }
+    /* Only the start of a buffer can go back to the free queue */
+    return (p - pool_data) % pool_stats.buffer_size == 0;
+}
+
+void DmaPoolGetStats(dma_pool_stats_t* stats){
+    portENTER_CRITICAL(&pool_lock);
+    *stats = pool_stats;
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+/*==================[end of file]============================================*/
@@ -13,14 +13,15 @@
 #include "gpio_fast_out_mcu.h"
 #include "gpio_mcu.h"
 #include <stdint.h>
-#include <string.h>
+#include <stddef.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
 dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+int bundleA_gpios[GPIO_FAST_MAX];
+uint32_t bundleA_mask = 0;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -32,7 +33,17 @@ int bundleA_gpios[16];
 /*==================[external functions definition]==========================*/
 
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
+    if(pin_qty > GPIO_FAST_MAX){
+        pin_qty = GPIO_FAST_MAX;
+    }
+    if(bundleA != NULL){
+        dedic_gpio_del_bundle(bundleA);
+        bundleA = NULL;
+    }
+    for (int i = 0; i < pin_qty; i++) {
+        bundleA_gpios[i] = pin_list[i];
+    }
+    bundleA_mask = (1UL << pin_qty) - 1;
     gpio_config_t io_conf = {
         .mode = GPIO_MODE_OUTPUT,
     };
@@ -52,7 +63,7 @@ void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
 }
 
 void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+    dedic_gpio_bundle_write(bundleA, bundleA_mask, value);
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
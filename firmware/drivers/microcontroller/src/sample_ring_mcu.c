@@ -0,0 +1,136 @@
+/**
+ * @file sample_ring_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sample_ring_mcu.h"
+#include <stdint.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void SampleRingOverrun(sample_ring_t *ring, sample_ring_reader_t *reader, uint32_t from, uint32_t head){
+    /* Samples older than one capacity behind head were overwritten */
+    uint32_t lost = head - from - ring->capacity;
+    if((int32_t)(from + lost - reader->tail) > 0){
+        reader->tail = from + lost;
+    }
+    reader->overruns++;
+    reader->lost += lost;
+}
+
+/*==================[external functions definition]==========================*/
+uint8_t SampleRingInit(sample_ring_t *ring, uint32_t capacity, uint8_t sample_size){
+    uint32_t size = 1;
+    while(size < capacity){
+        size <<= 1;
+    }
+    ring->data = heap_caps_malloc(size * sample_size, MALLOC_CAP_INTERNAL);
+    if(ring->data == NULL){
+        return 1;
+    }
+    ring->capacity = size;
+    ring->sample_size = sample_size;
+    ring->head = 0;
+    return 0;
+}
+
+void SampleRingDeInit(sample_ring_t *ring){
+    heap_caps_free(ring->data);
+    ring->data = NULL;
+    ring->capacity = 0;
+}
+
+void IRAM_ATTR SampleRingWrite(sample_ring_t *ring, const void *samples, uint32_t count){
+    const uint8_t *src = samples;
+    uint32_t head = ring->head + count;
+    uint32_t index, chunk;
+    /* Only the last capacity samples can be kept */
+    if(count > ring->capacity){
+        src += (count - ring->capacity) * ring->sample_size;
+        count = ring->capacity;
+    }
+    index = (head - count) & (ring->capacity - 1);
+    while(count > 0){
+        chunk = ring->capacity - index;
+        if(chunk > count){
+            chunk = count;
+        }
+        memcpy(&ring->data[index * ring->sample_size], src, chunk * ring->sample_size);
+        src += chunk * ring->sample_size;
+        count -= chunk;
+        index = 0;
+    }
+    /* Samples must be in memory before consumers see the new head */
+    __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+}
+
+uint32_t IRAM_ATTR SampleRingWriteSpan(sample_ring_t *ring, void **span){
+    uint32_t index = ring->head & (ring->capacity - 1);
+    *span = &ring->data[index * ring->sample_size];
+    return ring->capacity - index;
+}
+
+void IRAM_ATTR SampleRingCommit(sample_ring_t *ring, uint32_t count){
+    __atomic_store_n(&ring->head, ring->head + count, __ATOMIC_RELEASE);
+}
+
+void SampleRingReaderInit(sample_ring_t *ring, sample_ring_reader_t *reader){
+    reader->tail = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    reader->overruns = 0;
+    reader->lost = 0;
+}
+
+uint32_t SampleRingAvailable(sample_ring_t *ring, sample_ring_reader_t *reader){
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if(head - reader->tail > ring->capacity){
+        return ring->capacity;
+    }
+    return head - reader->tail;
+}
+
+uint32_t SampleRingPeek(sample_ring_t *ring, sample_ring_reader_t *reader, const void **span){
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t index, count;
+    if(head - reader->tail > ring->capacity){
+        SampleRingOverrun(ring, reader, reader->tail, head);
+    }
+    index = reader->tail & (ring->capacity - 1);
+    count = head - reader->tail;
+    if(count > ring->capacity - index){
+        count = ring->capacity - index;
+    }
+    *span = &ring->data[index * ring->sample_size];
+    return count;
+}
+
+bool SampleRingRelease(sample_ring_t *ring, sample_ring_reader_t *reader, uint32_t count){
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t from = reader->tail;
+    reader->tail += count;
+    /* The samples read must not have been overwritten while they were used */
+    if(head - from > ring->capacity){
+        SampleRingOverrun(ring, reader, from, head);
+        return false;
+    }
+    return true;
+}
+
+/*==================[end of file]============================================*/
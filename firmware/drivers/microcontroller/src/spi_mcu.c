@@ -13,8 +13,10 @@
 #include "spi_mcu.h"
 #include <stdint.h>
 #include <string.h>
+#include "freertos/FreeRTOS.h"
 #include "driver/spi_master.h"
 #include "gpio_mcu.h"
+#include "dma_pool_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
 #define PIN_NUM_MOSI	GPIO_21	/*!<  */
@@ -22,82 +24,139 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_DEV_QTY		3		/*!< Number of devices that can be connected to the bus */
+#define TX_DATA_SIZE	4		/*!< Transactions up to this size are copied into the transaction itself */
 /*==================[internal data declaration]==============================*/
-spi_device_handle_t spi_1, spi_2, spi_3;
+spi_device_handle_t spi_handle[SPI_DEV_QTY];	/*!< Handle of each device registered in the bus */
 const spi_bus_config_t bus_cfg = {
     .miso_io_num = PIN_NUM_MISO,
     .mosi_io_num = PIN_NUM_MOSI,
     .sclk_io_num = PIN_NUM_CLK,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 4092
+    .max_transfer_sz = SPI_MAX_TRANSFER_SIZE
 };
-transfer_mode_t transfer_mode_1, transfer_mode_2, transfer_mode_3;
-void (*spi_1_isr_p)(void*);	/*!<  */
-void (*spi_2_isr_p)(void*);	/*!<  */
-void (*spi_3_isr_p)(void*);	/*!<  */
-void *spi_1_user_data;	    /*!<  */
-void *spi_2_user_data;	    /*!<  */
-void *spi_3_user_data;	    /*!<  */
+const gpio_t spi_cs_pin[SPI_DEV_QTY] = {PIN_NUM_CS1, PIN_NUM_CS2, PIN_NUM_CS3};	/*!< Chip select of each device */
+transfer_mode_t transfer_mode[SPI_DEV_QTY];		/*!< Transfer mode of each device */
+void (*spi_isr_p[SPI_DEV_QTY])(void*);			/*!< Transaction end callback of each device */
+void *spi_user_data[SPI_DEV_QTY];				/*!< Transaction end callback parameter of each device */
+void (*spi_pre_p[SPI_DEV_QTY])(void*);			/*!< Transaction start callback of each device */
+spi_transaction_t spi_queue[SPI_DEV_QTY][SPI_QUEUE_SIZE];	/*!< Transactions in flight for each device */
+uint8_t spi_queue_size[SPI_DEV_QTY];						/*!< Number of transactions that can be in flight for each device */
+uint8_t spi_queue_head[SPI_DEV_QTY];						/*!< Next free transaction slot for each device */
+uint8_t spi_queue_pending[SPI_DEV_QTY];						/*!< Number of transactions in flight for each device */
+bool spi_queue_pooled[SPI_DEV_QTY][SPI_QUEUE_SIZE];			/*!< Transaction buffer must be given back to the DMA pool */
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
-	spi_1_isr_p(spi_1_user_data);
+	spi_isr_p[SPI_1](spi_user_data[SPI_1]);
 }
 static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
-	spi_2_isr_p(spi_2_user_data);
+	spi_isr_p[SPI_2](spi_user_data[SPI_2]);
 }
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
-	spi_3_isr_p(spi_3_user_data);
+	spi_isr_p[SPI_3](spi_user_data[SPI_3]);
+}
+static void IRAM_ATTR spi_1_pre(spi_transaction_t *t){
+	spi_pre_p[SPI_1](t->user);
+}
+static void IRAM_ATTR spi_2_pre(spi_transaction_t *t){
+	spi_pre_p[SPI_2](t->user);
+}
+static void IRAM_ATTR spi_3_pre(spi_transaction_t *t){
+	spi_pre_p[SPI_3](t->user);
 }
 /*==================[internal data definition]===============================*/
-
+static transaction_cb_t const spi_isr[SPI_DEV_QTY] = {spi_1_isr, spi_2_isr, spi_3_isr};
+static transaction_cb_t const spi_pre[SPI_DEV_QTY] = {spi_1_pre, spi_2_pre, spi_3_pre};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void SpiTransmit(spi_dev_t device, spi_transaction_t *t){
+    /* Queued transactions of the device must end before a blocking one starts */
+    SpiWaitQueue(device);
+    switch(transfer_mode[device]){
+        case SPI_POLLING:
+            spi_device_polling_transmit(spi_handle[device], t);
+            break;
+        case SPI_INTERRUPT:
+            spi_device_transmit(spi_handle[device], t);
+            break;
+    }
+}
+
+static void SpiRelease(spi_dev_t device){
+    spi_transaction_t *done;
+    uint8_t slot;
+    spi_device_get_trans_result(spi_handle[device], &done, portMAX_DELAY);
+    spi_queue_pending[device]--;
+    slot = done - spi_queue[device];
+    if(spi_queue_pooled[device][slot]){
+        DmaBufferGive((uint8_t *)done->tx_buffer);
+        spi_queue_pooled[device][slot] = false;
+    }
+}
+
+static void SpiQueue(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size, void * user){
+    spi_transaction_t *t;
+    /* If every slot is in flight, wait for the oldest one to be released */
+    if(spi_queue_pending[device] == spi_queue_size[device]){
+        SpiRelease(device);
+    }
+    t = &spi_queue[device][spi_queue_head[device]];
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = buffer_size * 8;
+    t->user = user;
+    if(tx_buffer != NULL && buffer_size <= TX_DATA_SIZE){
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, tx_buffer, buffer_size);
+    } else{
+        t->tx_buffer = tx_buffer;
+    }
+    if(rx_buffer != NULL){
+        t->rxlength = buffer_size * 8;
+        t->rx_buffer = rx_buffer;
+    }
+    spi_device_queue_trans(spi_handle[device], t, portMAX_DELAY);
+    spi_queue_head[device] = (spi_queue_head[device] + 1) % SPI_QUEUE_SIZE;
+    spi_queue_pending[device]++;
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
     static bool spi_initialized = false;
+    spi_dev_t device = spi->device;
     if(!spi_initialized){
 	    spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
         spi_initialized = true;
     }
+    if(spi_handle[device] != NULL){
+        SpiDeInit(device);
+    }
+    transfer_mode[device] = spi->transfer_mode;
+    spi_isr_p[device] = spi->func_p;
+    spi_user_data[device] = spi->param_p;
+    spi_pre_p[device] = spi->pre_func_p;
+    spi_queue_size[device] = spi->queue_size;
+    if(spi_queue_size[device] == 0 || spi_queue_size[device] > SPI_QUEUE_SIZE){
+        spi_queue_size[device] = SPI_QUEUE_SIZE;
+    }
+    spi_queue_head[device] = 0;
+    spi_queue_pending[device] = 0;
 	spi_device_interface_config_t dev_cfg = {
-        .clock_speed_hz = spi->bitrate,     	
-        .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .clock_speed_hz = spi->bitrate,
+        .mode = spi->clk_mode,
+        .spics_io_num = spi_cs_pin[device],
+        .queue_size = spi_queue_size[device],
     };
-    switch(spi->device){
-        case SPI_1:
-            dev_cfg.spics_io_num = PIN_NUM_CS1;
-            transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
-            spi_1_isr_p = spi->func_p;
-            spi_1_user_data = spi->param_p;
-            break;
-        case SPI_2:
-            dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
-            spi_2_isr_p = spi->func_p;
-            spi_2_user_data = spi->param_p;
-            break;
-        case SPI_3:
-            dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
-            spi_3_isr_p = spi->func_p;
-            spi_3_user_data = spi->param_p;
-            break;
+    if(spi->pre_func_p != NULL){
+        dev_cfg.pre_cb = spi_pre[device];
+    }
+    if(transfer_mode[device] == SPI_INTERRUPT && spi->func_p != NULL){
+        dev_cfg.post_cb = spi_isr[device];
+    }
+    if(spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_handle[device]) != ESP_OK){
+        spi_handle[device] = NULL;
+        return 1;
     }
     return 0;
 }
@@ -108,38 +167,7 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
     t.rx_buffer = rx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    SpiTransmit(device, &t);
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
@@ -147,38 +175,7 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    SpiTransmit(device, &t);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
@@ -188,41 +185,60 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     t.rxlength = buffer_size * 8;
     t.tx_buffer = tx_buffer;        // Data
     t.rx_buffer = rx_buffer;        
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
+    SpiTransmit(device, &t);
+}
+
+void SpiQueueWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size, void * user){
+    SpiQueue(device, tx_buffer, NULL, tx_buffer_size, user);
+}
+
+void SpiQueueWritePooled(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size, void * user){
+    spi_transaction_t *t = &spi_queue[device][spi_queue_head[device]];
+    if(tx_buffer_size <= TX_DATA_SIZE){
+        /* Small transfers are copied into the transaction, the buffer is not needed anymore */
+        SpiQueue(device, tx_buffer, NULL, tx_buffer_size, user);
+        DmaBufferGive(tx_buffer);
+        return;
+    }
+    SpiQueue(device, tx_buffer, NULL, tx_buffer_size, user);
+    spi_queue_pooled[device][t - spi_queue[device]] = true;
+}
+
+void SpiQueueRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size, void * user){
+    SpiQueue(device, NULL, rx_buffer, rx_buffer_size, user);
+}
+
+void SpiQueueReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size, void * user){
+    SpiQueue(device, tx_buffer, rx_buffer, buffer_size, user);
+}
+
+void SpiWaitQueue(spi_dev_t device){
+    SpiWaitPending(device, 0);
+}
+
+void SpiWaitPending(spi_dev_t device, uint8_t pending){
+    while(spi_queue_pending[device] > pending){
+        SpiRelease(device);
     }
 }
 
+void SpiAcquireBus(spi_dev_t device){
+    spi_device_acquire_bus(spi_handle[device], portMAX_DELAY);
+}
+
+void SpiReleaseBus(spi_dev_t device){
+    spi_device_release_bus(spi_handle[device]);
+}
+
 uint8_t SpiDeInit(spi_dev_t device){
+    if(spi_handle[device] == NULL){
+        return 1;
+    }
+    SpiWaitQueue(device);
+    if(spi_bus_remove_device(spi_handle[device]) != ESP_OK){
+        return 1;
+    }
+    spi_handle[device] = NULL;
     return 0;
 }
 
@@ -0,0 +1,89 @@
+#ifndef DECIMATOR_H_
+#define DECIMATOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Decimator Decimator
+ */
+
+/** \brief Oversampling and decimation stage
+ * 
+ * Signals sampled at a high rate (e.g. ADC continuous frames) are filtered with a low 
+ * pass anti-alias FIR and only one of every "ratio" outputs is computed (esp-dsp 
+ * decimating FIR). Averaging "ratio" samples reduces the uncorrelated noise by 
+ * sqrt(ratio), so the float output has more effective resolution than the input.
+ * 
+ * Typical use with the ADC:
+ * AnalogScanRead() -> AnalogRawToFloat() -> DecimatorProcess()
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define DECIMATOR_TAPS_PER_RATIO	8		/*!< Default filter length: taps for each unit of the ratio */
+#define DECIMATOR_BANDWIDTH			0.8f	/*!< Cut-off frequency, as a fraction of the output Nyquist frequency */
+/*==================[typedef]================================================*/
+/**
+ * @brief Decimator state
+ */
+typedef struct {
+	fir_f32_t fir;			/*!< esp-dsp decimating FIR */
+	float *coeffs;			/*!< Anti-alias filter coefficients */
+	float *delay;			/*!< Filter delay line */
+	float *pending;			/*!< Input samples not processed yet (less than ratio) */
+	uint16_t pending_count;	/*!< Number of pending input samples */
+	uint16_t ratio;			/*!< Decimation ratio */
+} decimator_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design the anti-alias filter and initialize a decimator
+ * 
+ * @param dec       Decimator state
+ * @param ratio     Decimation ratio (input rate / output rate)
+ * @param taps      Filter length (0: DECIMATOR_TAPS_PER_RATIO * ratio)
+ * @return true     Decimator initialized
+ * @return false    Not enough memory
+ */
+bool DecimatorInit(decimator_t * dec, uint16_t ratio, uint16_t taps);
+
+/**
+ * @brief Free the memory of a decimator
+ * 
+ * @param dec       Decimator state
+ */
+void DecimatorDeInit(decimator_t * dec);
+
+/**
+ * @brief Filter and decimate a block of samples
+ * 
+ * @note Blocks of any length can be processed: input samples left over from a block are 
+ * used with the next one.
+ * 
+ * @param dec               Decimator state
+ * @param input_signal      Input signal array
+ * @param output_signal     Decimated signal array (at least signal_lenght / ratio + 1 samples)
+ * @param signal_lenght     Number of input samples
+ * @return uint16_t         Number of output samples
+ */
+uint16_t DecimatorProcess(decimator_t * dec, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DECIMATOR_H_ */
+
+/*==================[end of file]============================================*/
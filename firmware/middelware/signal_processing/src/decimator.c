@@ -0,0 +1,107 @@
+/**
+ * @file decimator.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "decimator.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void DesignLowPass(float * coeffs, uint16_t taps, float cut_frec){
+    float center = (taps - 1) / 2.0f;
+    float x, sum = 0;
+    // Blackman window
+    dsps_wind_blackman_f32(coeffs, taps);
+    // Windowed sinc
+    for (int i = 0; i < taps; i++){
+        x = i - center;
+        if (x == 0){
+            coeffs[i] *= 2 * cut_frec;
+        } else{
+            coeffs[i] *= sinf(2 * M_PI * cut_frec * x) / (M_PI * x);
+        }
+        sum += coeffs[i];
+    }
+    // Unity gain at DC
+    for (int i = 0; i < taps; i++){
+        coeffs[i] /= sum;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool DecimatorInit(decimator_t * dec, uint16_t ratio, uint16_t taps){
+    memset(dec, 0, sizeof(decimator_t));
+    if (ratio == 0){
+        return false;
+    }
+    if (taps == 0){
+        taps = DECIMATOR_TAPS_PER_RATIO * ratio;
+    }
+    dec->coeffs = malloc(taps * sizeof(float));
+    dec->delay = malloc(taps * sizeof(float));
+    dec->pending = malloc(ratio * sizeof(float));
+    if (dec->coeffs == NULL || dec->delay == NULL || dec->pending == NULL){
+        DecimatorDeInit(dec);
+        return false;
+    }
+    dec->ratio = ratio;
+    // Cut-off below the Nyquist frequency of the output rate
+    DesignLowPass(dec->coeffs, taps, DECIMATOR_BANDWIDTH * 0.5f / ratio);
+    dsps_fird_init_f32(&dec->fir, dec->coeffs, dec->delay, taps, ratio);
+    return true;
+}
+
+void DecimatorDeInit(decimator_t * dec){
+    free(dec->coeffs);
+    free(dec->delay);
+    free(dec->pending);
+    memset(dec, 0, sizeof(decimator_t));
+}
+
+uint16_t DecimatorProcess(decimator_t * dec, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    uint16_t outputs = 0, chunk;
+    // Complete the samples left over from the previous block
+    if (dec->pending_count > 0){
+        chunk = dec->ratio - dec->pending_count;
+        if (chunk > signal_lenght){
+            chunk = signal_lenght;
+        }
+        memcpy(&dec->pending[dec->pending_count], input_signal, chunk * sizeof(float));
+        dec->pending_count += chunk;
+        input_signal += chunk;
+        signal_lenght -= chunk;
+        if (dec->pending_count < dec->ratio){
+            return 0;
+        }
+        outputs += dsps_fird_f32(&dec->fir, dec->pending, output_signal, 1);
+        dec->pending_count = 0;
+    }
+    // Every complete group of ratio samples gives one output
+    outputs += dsps_fird_f32(&dec->fir, input_signal, &output_signal[outputs], signal_lenght / dec->ratio);
+    // Keep the rest for the next block
+    chunk = signal_lenght % dec->ratio;
+    memcpy(dec->pending, &input_signal[signal_lenght - chunk], chunk * sizeof(float));
+    dec->pending_count = chunk;
+    return outputs;
+}
+
+/*==================[end of file]============================================*/
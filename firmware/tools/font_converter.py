@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+@file font_converter.py
+@brief Generates anti-aliased (2 or 4 bpp) run length encoded fonts for the ILI9341 driver.
+
+The output is C code in the same layout as fonts.c: a data array, a character
+info array and an AAFont_t structure. Paste it in fonts.c and declare the
+AAFont_t structure in fonts.h.
+
+Glyphs can be rendered from a TrueType font (requires Pillow):
+
+    python3 font_converter.py --ttf Roboto-Regular.ttf --size 30 --bpp 4 --name font_aa_30
+
+or supersampled from one of the 1 bpp fonts of fonts.c, e.g. the 89 pixels
+font reduced 3 times gives a 30 pixels anti-aliased font:
+
+    python3 font_converter.py --c-font ../drivers/devices/src/fonts.c --source font_89 --scale 3 --bpp 4 --name font_aa_30
+
+Encoding: every glyph row is a sequence of runs of pixels with the same
+intensity, one byte per run: (run length - 1) in the upper (8 - bpp) bits and
+intensity in the lower bpp bits (0: background, 2^bpp - 1: foreground).
+Runs never cross rows.
+"""
+
+import argparse
+import re
+import sys
+
+SHADES = " .:-=+*#%@"
+
+
+def parse_c_font(path, source):
+    """Reads a 1 bpp font of fonts.c. Returns (height, first char, glyphs), glyphs as lists of rows of 0/255 values."""
+    text = open(path, encoding="utf-8").read()
+    font = re.search(r"Font_t\s+" + source + r"\s*=\s*\{\s*(\d+)\s*,\s*(\w+)\s*,\s*(\w+)", text)
+    if font is None:
+        sys.exit("font %s not found in %s" % (source, path))
+    height, info_name, data_name = int(font.group(1)), font.group(2), font.group(3)
+
+    data_src = re.search(re.escape(data_name) + r"\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    data_src = re.sub(r"//[^\n]*|/\*.*?\*/", "", data_src, flags=re.S)
+    data = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]+", data_src)]
+
+    info_src = re.search(re.escape(info_name) + r"\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    info = [(int(w), int(o)) for w, o in re.findall(r"\{\s*(\d+)\s*,\s*(\d+)\s*\}", info_src)]
+
+    glyphs = []
+    for width, offset in info:
+        row_bytes = (width + 7) // 8
+        rows = []
+        for i in range(height):
+            row = data[offset + i * row_bytes:offset + (i + 1) * row_bytes]
+            rows.append([255 if row[j // 8] & (0x80 >> (j % 8)) else 0 for j in range(width)])
+        glyphs.append(rows)
+    return height, " ", glyphs
+
+
+def downsample(rows, scale):
+    """Box filter: every scale x scale block of pixels gives one pixel with the mean intensity."""
+    height = len(rows)
+    width = len(rows[0]) if height else 0
+    out_w = (width + scale - 1) // scale
+    out_h = (height + scale - 1) // scale
+    out = []
+    for y in range(out_h):
+        out_row = []
+        for x in range(out_w):
+            acc = 0
+            for yy in range(y * scale, min((y + 1) * scale, height)):
+                for xx in range(x * scale, min((x + 1) * scale, width)):
+                    acc += rows[yy][xx]
+            out_row.append(acc // (scale * scale))
+        out.append(out_row)
+    return out
+
+
+def render_ttf(path, size, first, last):
+    """Renders the characters of a TrueType font. Returns (height, glyphs)."""
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("Pillow is required to convert TrueType fonts (pip install pillow)")
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    glyphs = []
+    for code in range(ord(first), ord(last) + 1):
+        width = max(1, int(round(font.getlength(chr(code)))))
+        image = Image.new("L", (width, height), 0)
+        ImageDraw.Draw(image).text((0, 0), chr(code), font=font, fill=255)
+        glyphs.append([[image.getpixel((x, y)) for x in range(width)] for y in range(height)])
+    return height, glyphs
+
+
+def encode_row(row, bpp):
+    """Run length encodes a row of 0..255 intensities."""
+    levels = (1 << bpp) - 1
+    max_run = 256 >> bpp
+    values = [(v * levels + 127) // 255 for v in row]
+    runs = []
+    j = 0
+    while j < len(values):
+        run = 1
+        while j + run < len(values) and values[j + run] == values[j] and run < max_run:
+            run += 1
+        runs.append(((run - 1) << bpp) | values[j])
+        j += run
+    return runs, values
+
+
+def c_char(code):
+    return chr(code) if chr(code) not in "\\'" else "\\" + chr(code)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--ttf", help="TrueType font file")
+    parser.add_argument("--size", type=int, help="TrueType font size in pixels")
+    parser.add_argument("--c-font", help="fonts.c file with the 1 bpp source font")
+    parser.add_argument("--source", help="Font_t structure of the source font (e.g. font_89)")
+    parser.add_argument("--scale", type=int, default=1, help="Supersampling factor of the source glyphs")
+    parser.add_argument("--bpp", type=int, choices=(2, 4), default=4, help="Bits per pixel")
+    parser.add_argument("--first", default=" ", help="First character")
+    parser.add_argument("--last", default="~", help="Last character")
+    parser.add_argument("--name", required=True, help="Name of the AAFont_t structure")
+    args = parser.parse_args()
+
+    if args.ttf:
+        if args.size is None:
+            parser.error("--size is required with --ttf")
+        height, glyphs = render_ttf(args.ttf, args.size, args.first, args.last)
+    elif args.c_font and args.source:
+        height, first, glyphs = parse_c_font(args.c_font, args.source)
+        glyphs = glyphs[ord(args.first) - ord(first):ord(args.last) - ord(first) + 1]
+    else:
+        parser.error("--ttf or --c-font and --source are required")
+
+    if args.scale > 1:
+        glyphs = [downsample(g, args.scale) for g in glyphs]
+        height = (height + args.scale - 1) // args.scale
+
+    base = args.name
+    levels = (1 << args.bpp) - 1
+    data_lines = []
+    info_lines = []
+    offset = 0
+    for index, rows in enumerate(glyphs):
+        code = ord(args.first) + index
+        width = len(rows[0])
+        glyph_offset = offset
+        data_lines.append("\t/* @%d '%s' (%d pixels wide) */" % (offset, c_char(code), width))
+        for row in rows:
+            runs, values = encode_row(row, args.bpp)
+            shades = "".join(SHADES[v * (len(SHADES) - 1) // levels] for v in values)
+            data_lines.append("\t" + " ".join("0x%02X," % r for r in runs) + " // " + shades)
+            offset += len(runs)
+        data_lines.append("")
+        info_lines.append("\t{%d, %d}, \t\t/* %s */ " % (width, glyph_offset, c_char(code)))
+
+    print("/**")
+    print(" * @brief %d pixels height anti-aliased (%d bpp) data array. " % (height, args.bpp))
+    print(" */")
+    print("const uint8_t %s_data[] = {" % base)
+    print("\n".join(data_lines).rstrip("\n"))
+    print("};")
+    print()
+    print("/**")
+    print(" * @brief %d pixels height anti-aliased (%d bpp) char info array. " % (height, args.bpp))
+    print(" */")
+    print("const aa_char_info_t %s_info[] = {" % base)
+    print("\n".join(info_lines))
+    print("};")
+    print()
+    print("AAFont_t %s = {" % args.name)
+    print("\t%d," % height)
+    print("\t%d," % args.bpp)
+    print("\t'%s'," % c_char(ord(args.first)))
+    print("\t'%s'," % c_char(ord(args.last)))
+    print("\t%s_info," % base)
+    print("\t%s_data" % base)
+    print("};")
+    print("/* %d bytes of glyph data */" % offset, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
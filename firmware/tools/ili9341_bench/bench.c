@@ -0,0 +1,136 @@
+/**
+ * @file bench.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief ILI9341 driver benchmark on the host panel model (panel_mock.c).
+ *
+ * Each case starts from a white screen and prints the SPI transactions and bytes
+ * it sends, the hash of the resulting frame memory and the host time spent in
+ * the driver (the bus itself takes no time). The full screen fill is also
+ * checked against the transactions it needs: the window (column and page
+ * address set with their parameters, memory write) and one transaction per
+ * SPI_MAX_TRANSFER_SIZE block of pixels. The program returns 1 if it fails.
+ * Build and compare revisions with run_bench.sh, which enables the cases that
+ * need data or driver functions missing in some revisions:
+ * - HAVE_DRAW_STRING_AA: ILI9341DrawStringAA() and font_aa_30
+ * - HAVE_DRAW_IMAGE: ILI9341DrawImage() and esp_edu_pic
+ * - HAVE_RAW_PICTURE: raw RGB565 esp_edu_pic array named picture[]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ili9341.h"
+#include "panel_mock.h"
+/*==================[macros and definitions]=================================*/
+#define TEXT_REPS_DEFAULT   20000       /*!< Times the text case draws its string */
+#define TEXT                "0123456789"
+#define LCD_PIXELS          (240 * 320)
+#define WINDOW_TRANSACTIONS 5           /*!< Column/page address set (command and parameters) and memory write */
+#define WINDOW_BYTES        11          /*!< 3 commands and 2 x 4 address bytes */
+#define FILL_TRANSACTIONS   (WINDOW_TRANSACTIONS + (LCD_PIXELS * 2 + SPI_MAX_TRANSFER_SIZE - 1) / SPI_MAX_TRANSFER_SIZE)
+/*==================[internal data declaration]==============================*/
+static uint32_t text_reps = TEXT_REPS_DEFAULT;
+static struct timespec start;
+#ifdef HAVE_RAW_PICTURE
+extern const uint8_t picture[];
+#endif
+/*==================[internal functions definition]==========================*/
+static void CaseStart(void){
+	ILI9341Fill(ILI9341_WHITE);
+	PanelMockResetStats();
+	clock_gettime(CLOCK_MONOTONIC, &start);
+}
+
+static void CaseEnd(const char *name){
+	struct timespec end;
+	panel_mock_stats_t stats;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	PanelMockGetStats(&stats);
+	printf("%-16s %12u %10u   %08x %10.1f\n", name, stats.transactions, stats.bytes, PanelMockHash(),
+		(end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+static int CaseCheck(const char *name, uint32_t transactions, uint32_t bytes){
+	panel_mock_stats_t stats;
+	PanelMockGetStats(&stats);
+	if (stats.transactions != transactions || stats.bytes != bytes){
+		fprintf(stderr, "%s: %u transactions and %u bytes, expected %u and %u\n", name,
+			stats.transactions, stats.bytes, transactions, bytes);
+		return 1;
+	}
+	return 0;
+}
+
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+	int fail = 0;
+	if (argc > 1){
+		text_reps = strtoul(argv[1], NULL, 0);
+	}
+	ILI9341Init(SPI_1, PANEL_MOCK_GPIO_DC, PANEL_MOCK_GPIO_RST);
+	ILI9341Rotate(ILI9341_Portrait_1);
+	printf("%-16s %12s %10s   %8s %10s\n", "case", "transactions", "bytes", "frame", "host (ms)");
+
+	/* Full screen fill: one window and the pixel blocks */
+	CaseStart();
+	ILI9341Fill(ILI9341_BLACK);
+	CaseEnd("fill");
+#ifdef SPI_MAX_TRANSFER_SIZE
+	fail |= CaseCheck("fill", FILL_TRANSACTIONS, WINDOW_BYTES + LCD_PIXELS * 2);
+#endif
+
+	/* Primitives */
+	CaseStart();
+	ILI9341DrawLine(10, 20, 230, 120, ILI9341_RED);
+	CaseEnd("line");
+	CaseStart();
+	ILI9341DrawLine(20, 10, 120, 310, ILI9341_RED);
+	CaseEnd("line (steep)");
+	CaseStart();
+	ILI9341DrawCircle(120, 160, 100, ILI9341_BLUE);
+	CaseEnd("circle");
+	CaseStart();
+	ILI9341DrawFilledCircle(120, 160, 60, ILI9341_BLUE);
+	CaseEnd("filled circle");
+	CaseStart();
+	ILI9341DrawTriangle(20, 300, 120, 20, 220, 250, ILI9341_BLACK);
+	CaseEnd("triangle");
+	CaseStart();
+	ILI9341DrawFilledTriangle(20, 300, 120, 20, 220, 250, ILI9341_BLACK);
+	CaseEnd("filled triangle");
+
+	/* Text */
+	CaseStart();
+	for (uint32_t i = 0; i < text_reps; i++){
+		ILI9341DrawString(0, 0, TEXT, &font_30, ILI9341_BLACK, ILI9341_WHITE);
+	}
+	CaseEnd("text font_30");
+#ifdef HAVE_DRAW_STRING_AA
+	CaseStart();
+	for (uint32_t i = 0; i < text_reps; i++){
+		ILI9341DrawStringAA(0, 0, TEXT, &font_aa_30, ILI9341_BLACK, ILI9341_WHITE);
+	}
+	CaseEnd("text font_aa_30");
+#endif
+
+	/* Images */
+#ifdef HAVE_RAW_PICTURE
+	CaseStart();
+	ILI9341DrawPicture(0, 0, 240, 320, picture);
+	CaseEnd("picture (raw)");
+#endif
+#ifdef HAVE_DRAW_IMAGE
+	CaseStart();
+	ILI9341DrawImage(0, 0, &esp_edu_pic);
+	CaseEnd("image");
+#endif
+	return fail;
+}
+
+/*==================[end of file]============================================*/
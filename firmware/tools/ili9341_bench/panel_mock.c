@@ -0,0 +1,159 @@
+/**
+ * @file panel_mock.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Host model of the ILI9341 panel, see panel_mock.h
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "panel_mock.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spi_mcu.h"
+#include "gpio_mcu.h"
+#include "delay_mcu.h"
+#if __has_include("dma_pool_mcu.h")
+#include "dma_pool_mcu.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define MEM_SIDE            320     /*!< Frame memory is 240x320, MADCTL may swap rows and columns */
+#define COLUMN_ADDR_SET     0x2A
+#define PAGE_ADDR_SET       0x2B
+#define MEM_WRITE           0x2C
+#define MEM_WRITE_CONT      0x3C
+#define GPIO_QTY            64
+#define FNV_OFFSET          2166136261u
+#define FNV_PRIME           16777619u
+/*==================[internal data declaration]==============================*/
+static uint16_t memory[MEM_SIDE][MEM_SIDE];     /*!< Frame memory [page][column] */
+static bool gpio_state[GPIO_QTY];
+static void (*pre_func)(void *) = NULL;         /*!< Driver pre-transaction callback (sets DC) */
+static uint8_t command;                         /*!< Last command byte */
+static uint8_t param[4];                        /*!< Address set parameters */
+static uint32_t param_count;                    /*!< Data bytes received since the last command */
+static uint16_t col_start, col_end, page_start, page_end;
+static uint16_t col, page;                      /*!< Memory write pointer */
+static panel_mock_stats_t stats;
+/*==================[internal functions definition]==========================*/
+static void PanelData(uint8_t byte){
+	switch (command){
+	case COLUMN_ADDR_SET:
+	case PAGE_ADDR_SET:
+		if (param_count < 4){
+			param[param_count] = byte;
+		}
+		if (param_count == 3){
+			uint16_t start = (param[0] << 8) | param[1];
+			uint16_t end = (param[2] << 8) | param[3];
+			if (command == COLUMN_ADDR_SET){
+				col_start = start;
+				col_end = end;
+			}
+			else{
+				page_start = start;
+				page_end = end;
+			}
+		}
+		break;
+	case MEM_WRITE:
+	case MEM_WRITE_CONT:
+		if (param_count & 1){
+			if (col < MEM_SIDE && page < MEM_SIDE){
+				memory[page][col] = (param[0] << 8) | byte;
+			}
+			if (++col > col_end){
+				col = col_start;
+				if (++page > page_end){
+					page = page_start;
+				}
+			}
+		}
+		else{
+			param[0] = byte;
+		}
+		break;
+	default:
+		break;
+	}
+	param_count++;
+}
+
+static void PanelCommand(uint8_t byte){
+	command = byte;
+	param_count = 0;
+	if (command == MEM_WRITE){
+		col = col_start;
+		page = page_start;
+	}
+}
+
+/*==================[SPI]====================================================*/
+uint8_t SpiInit(spi_mcu_config_t *spi){
+	pre_func = spi->pre_func_p;
+	return 0;
+}
+
+void SpiQueueWrite(spi_dev_t device, uint8_t *tx_buffer, uint32_t tx_buffer_size, void *user){
+	(void)device;
+	if (pre_func != NULL){
+		pre_func(user);
+	}
+	stats.transactions++;
+	stats.bytes += tx_buffer_size;
+	for (uint32_t i = 0; i < tx_buffer_size; i++){
+		if (gpio_state[PANEL_MOCK_GPIO_DC]){
+			PanelData(tx_buffer[i]);
+		}
+		else{
+			PanelCommand(tx_buffer[i]);
+		}
+	}
+}
+
+/* Transactions are decoded when queued, so there is never anything to wait for */
+void SpiWaitQueue(spi_dev_t device){ (void)device; }
+void SpiWaitPending(spi_dev_t device, uint8_t pending){ (void)device; (void)pending; }
+
+/*==================[GPIO and delays]========================================*/
+void GPIOInit(gpio_t pin, io_t io){ (void)pin; (void)io; }
+void GPIOOn(gpio_t pin){ gpio_state[pin % GPIO_QTY] = true; }
+void GPIOOff(gpio_t pin){ gpio_state[pin % GPIO_QTY] = false; }
+void GPIOState(gpio_t pin, bool state){ gpio_state[pin % GPIO_QTY] = state; }
+void DelayMs(uint16_t msec){ (void)msec; }
+void DelayUs(uint16_t usec){ (void)usec; }
+
+/*==================[DMA pool]===============================================*/
+#if __has_include("dma_pool_mcu.h")
+uint8_t *DmaBufferTake(uint32_t wait_ms){
+	(void)wait_ms;
+	return malloc(SPI_MAX_TRANSFER_SIZE);
+}
+
+void DmaBufferGive(uint8_t *buffer){ free(buffer); }
+uint32_t DmaBufferSize(void){ return SPI_MAX_TRANSFER_SIZE; }
+#endif
+
+/*==================[external functions definition]==========================*/
+void PanelMockResetStats(void){
+	memset(&stats, 0, sizeof(stats));
+}
+
+void PanelMockGetStats(panel_mock_stats_t *out){
+	*out = stats;
+}
+
+uint32_t PanelMockHash(void){
+	uint32_t hash = FNV_OFFSET;
+	const uint8_t *byte = (const uint8_t *)memory;
+	for (uint32_t i = 0; i < sizeof(memory); i++){
+		hash = (hash ^ byte[i]) * FNV_PRIME;
+	}
+	return hash;
+}
+
+/*==================[end of file]============================================*/
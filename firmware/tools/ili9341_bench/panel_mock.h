@@ -0,0 +1,42 @@
+/**
+ * @file panel_mock.h
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Host model of the ILI9341 panel behind the SPI, GPIO, delay and DMA pool
+ * drivers, used by bench.c.
+ *
+ * SpiQueueWrite() transactions are decoded as the panel does (DC line set by the
+ * driver pre-transaction callback, column/page address set and memory write), so
+ * frame memory can be compared between revisions of ili9341.c. Every transaction
+ * and byte sent to the panel is counted.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PANEL_MOCK_H
+#define PANEL_MOCK_H
+
+#include <stdint.h>
+#include "gpio_mcu.h"
+
+#define PANEL_MOCK_GPIO_DC  GPIO_9  /*!< DC pin given to ILI9341Init() */
+#define PANEL_MOCK_GPIO_RST GPIO_18 /*!< RST pin given to ILI9341Init() */
+
+/**
+ * @brief Bus traffic since the last PanelMockResetStats()
+ */
+typedef struct {
+	uint32_t transactions;          /*!< SPI transactions */
+	uint32_t bytes;                 /*!< Bytes sent (commands, parameters and pixels) */
+} panel_mock_stats_t;
+
+void PanelMockResetStats(void);
+void PanelMockGetStats(panel_mock_stats_t *stats);
+
+/**
+ * @brief FNV-1a hash of the whole frame memory, equal hashes mean equal pixels.
+ */
+uint32_t PanelMockHash(void);
+
+#endif
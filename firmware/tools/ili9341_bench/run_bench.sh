@@ -0,0 +1,94 @@
+#!/bin/sh
+# Builds bench.c with the ILI9341 driver of the working tree and runs it on the
+# host panel model. With a git revision, the same benchmark is built with the
+# driver of that revision too and both runs are compared case by case. A second
+# revision replaces the working tree:
+#
+#   ./run_bench.sh                      # working tree only
+#   ./run_bench.sh HEAD                 # last commit against the working tree
+#   ./run_bench.sh HEAD^ HEAD           # before/after the last commit
+#   TEXT_REPS=2000 ./run_bench.sh       # fewer text repetitions (default 20000)
+#
+# Frames are "same" when the frame memory hashes match (pixel identical output).
+# The exit status is the one of bench.c for the newer driver (fill check).
+set -e
+
+BENCH=$(cd "$(dirname "$0")" && pwd)
+REPO=$(git -C "$BENCH" rev-parse --show-toplevel)
+DRIVERS=firmware/drivers
+PIC=$DRIVERS/devices/src/esp_edu_pic.c
+BEFORE=$1
+AFTER=$2
+REPS=${TEXT_REPS:-20000}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Raw RGB565 splash array, from the last revision that had it
+RAW=$(git -C "$REPO" log -1 --format=%H -S"const uint8_t picture[]" -- "$PIC")
+if [ -n "$RAW" ]; then
+	if git -C "$REPO" show "$RAW:$PIC" 2>/dev/null | grep -q "const uint8_t picture\[\]"; then
+		git -C "$REPO" show "$RAW:$PIC" > "$WORK/picture.c"
+	else
+		git -C "$REPO" show "$RAW^:$PIC" > "$WORK/picture.c"
+	fi
+fi
+
+# build <drivers dir> <output binary>
+build() {
+	src="$1/devices/src"
+	files="$src/ili9341.c $src/fonts.c $src/icons.c"
+	flags=""
+	if grep -q "ILI9341DrawStringAA" "$1/devices/inc/ili9341.h"; then
+		flags="$flags -DHAVE_DRAW_STRING_AA"
+	fi
+	if grep -q "ILI9341DrawImage" "$1/devices/inc/ili9341.h"; then
+		flags="$flags -DHAVE_DRAW_IMAGE"
+		files="$files $src/esp_edu_pic.c"
+	fi
+	if [ -f "$WORK/picture.c" ]; then
+		flags="$flags -DHAVE_RAW_PICTURE"
+		files="$files $WORK/picture.c"
+	fi
+	${CC:-cc} -O2 -w $flags -I"$BENCH/stub" -I"$BENCH" -I"$1/devices/inc" -I"$1/microcontroller/inc" \
+		-o "$2" "$BENCH/bench.c" "$BENCH/panel_mock.c" $files
+}
+
+# checkout <revision> <directory>: drivers of a revision, the working tree if empty
+checkout() {
+	if [ -z "$1" ]; then
+		echo "$REPO/$DRIVERS"
+		return
+	fi
+	mkdir "$2"
+	git -C "$REPO" archive "$1" "$DRIVERS" | tar -x -C "$2"
+	echo "$2/$DRIVERS"
+}
+
+build "$(checkout "$AFTER" "$WORK/after_tree")" "$WORK/after"
+if [ -z "$BEFORE" ]; then
+	"$WORK/after" "$REPS"
+	exit 0
+fi
+build "$(checkout "$BEFORE" "$WORK/before_tree")" "$WORK/before"
+# Older revisions may not pass the fill check, only the result of the newer one counts
+"$WORK/before" "$REPS" > "$WORK/before.txt" || true
+status=0
+"$WORK/after" "$REPS" > "$WORK/after.txt" || status=$?
+
+echo "before: $BEFORE"
+cat "$WORK/before.txt"
+echo
+echo "after: ${AFTER:-working tree}"
+cat "$WORK/after.txt"
+echo
+# Columns are fixed width: the case name is the first 16 characters
+awk 'FNR == 1 { next }
+	{ name = substr($0, 1, 16); split(substr($0, 17), f, " ") }
+	NR == FNR { before[name] = f[1] " " f[2] " " f[3] " " f[4]; next }
+	name in before {
+		split(before[name], b, " ")
+		if (!header++) printf "%-16s %24s %24s %6s %20s\n", "case", "transactions", "bytes", "frame", "host (ms)"
+		printf "%s %24s %24s %6s %20s\n", name, b[1] " -> " f[1], b[2] " -> " f[2],
+			(b[3] == f[3]) ? "same" : "DIFF", b[4] " -> " f[4]
+	}' "$WORK/before.txt" "$WORK/after.txt"
+exit $status
@@ -0,0 +1,7 @@
+/* Host build of the ILI9341 benchmark: ESP-IDF section attributes */
+#ifndef ESP_ATTR_H
+#define ESP_ATTR_H
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define DMA_ATTR
+#endif
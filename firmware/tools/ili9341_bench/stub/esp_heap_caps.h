@@ -0,0 +1,10 @@
+/* Host build of the ILI9341 benchmark: capability based allocator on the C heap */
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+#include <stdlib.h>
+#define MALLOC_CAP_DMA 0
+#define MALLOC_CAP_8BIT 0
+static inline void *heap_caps_malloc(size_t size, unsigned caps){ (void)caps; return malloc(size); }
+static inline void *heap_caps_calloc(size_t n, size_t size, unsigned caps){ (void)caps; return calloc(n, size); }
+static inline void heap_caps_free(void *ptr){ free(ptr); }
+#endif
@@ -0,0 +1,14 @@
+/* Host build of the ILI9341 benchmark: FreeRTOS types, there is no scheduler */
+#ifndef FREERTOS_H
+#define FREERTOS_H
+#include <stdint.h>
+#include <stddef.h>
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFF
+#endif
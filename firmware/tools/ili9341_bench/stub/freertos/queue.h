@@ -0,0 +1,11 @@
+/* Host build of the ILI9341 benchmark: queues are never created */
+#ifndef QUEUE_H
+#define QUEUE_H
+#include "freertos/FreeRTOS.h"
+typedef void *QueueHandle_t;
+static inline QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t size){ (void)len; (void)size; return NULL; }
+static inline void vQueueDelete(QueueHandle_t queue){ (void)queue; }
+static inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait){ (void)queue; (void)item; (void)wait; return pdFAIL; }
+static inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait){ (void)queue; (void)item; (void)wait; return pdFAIL; }
+static inline BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t wait){ (void)queue; (void)item; (void)wait; return pdFAIL; }
+#endif
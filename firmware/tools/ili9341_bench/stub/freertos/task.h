@@ -0,0 +1,12 @@
+/* Host build of the ILI9341 benchmark: tasks are never created */
+#ifndef TASK_H
+#define TASK_H
+#include "freertos/FreeRTOS.h"
+typedef void *TaskHandle_t;
+static inline BaseType_t xTaskCreate(void (*task)(void *), const char *name, uint32_t stack,
+		void *param, UBaseType_t priority, TaskHandle_t *handle){
+	(void)task; (void)name; (void)stack; (void)param; (void)priority; (void)handle;
+	return pdFAIL;
+}
+static inline void vTaskDelete(TaskHandle_t task){ (void)task; }
+#endif
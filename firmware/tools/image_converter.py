@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+@file image_converter.py
+@brief Generates compressed RGB565 images (ili9341_image_t) for ILI9341DrawImage().
+
+The output is a C file with the compressed data array and an ili9341_image_t
+structure. Images can be read from any format supported by Pillow:
+
+    python3 image_converter.py --image splash.png --name splash > splash.c
+
+or from a raw RGB565 C array (2 bytes/pixel, high byte first), as used by
+ILI9341DrawPicture():
+
+    python3 image_converter.py --c-array esp_edu_pic.c --width 240 --height 320 --name esp_edu_pic > esp_edu_pic.c
+
+Encoding (QOI-like, adapted to RGB565). Pixels are encoded row by row, the
+previous pixel starts as black and a table of 64 recently seen pixels starts
+cleared. Each chunk begins with a tag byte:
+
+    00iiiiii            INDEX:   pixel from the table, position i
+    01nnnnnn            RUN:     previous pixel repeated n + 1 times
+    10rrggbb            DIFF:    previous pixel + (r - 2, g - 2, b - 2) on each channel
+    11nnnnnn p0 ... pn  LITERAL: n + 1 pixels (2 bytes each, high byte first)
+
+Every pixel decoded from DIFF or LITERAL chunks is stored in the table at
+position (r * 3 + g * 5 + b * 7) % 64.
+"""
+
+import argparse
+import re
+import sys
+
+TAG_INDEX = 0x00
+TAG_RUN = 0x40
+TAG_DIFF = 0x80
+TAG_LITERAL = 0xC0
+MAX_RUN = 64
+
+
+def pixel_hash(p):
+    return ((p >> 11) * 3 + ((p >> 5) & 0x3F) * 5 + (p & 0x1F) * 7) % 64
+
+
+def read_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required to read images (pip install pillow)")
+    image = Image.open(path).convert("RGB")
+    pixels = [(r >> 3) << 11 | (g >> 2) << 5 | (b >> 3) for r, g, b in image.getdata()]
+    return image.width, image.height, pixels
+
+
+def read_c_array(path, width, height):
+    text = open(path, encoding="utf-8").read()
+    text = re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+    data = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]+", text)]
+    if len(data) < width * height * 2:
+        sys.exit("%s has %d bytes, %d expected" % (path, len(data), width * height * 2))
+    return [data[2 * i] << 8 | data[2 * i + 1] for i in range(width * height)]
+
+
+def encode(pixels):
+    out = bytearray()
+    table = [0] * 64
+    prev = 0
+    run = 0
+    literal = []
+
+    def flush_literal():
+        if literal:
+            out.append(TAG_LITERAL | (len(literal) - 1))
+            for p in literal:
+                out.extend((p >> 8, p & 0xFF))
+            del literal[:]
+
+    for p in pixels:
+        if p == prev:
+            flush_literal()
+            run += 1
+            if run == MAX_RUN:
+                out.append(TAG_RUN | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            out.append(TAG_RUN | (run - 1))
+            run = 0
+        h = pixel_hash(p)
+        if table[h] == p:
+            flush_literal()
+            out.append(TAG_INDEX | h)
+        else:
+            table[h] = p
+            dr = (p >> 11) - (prev >> 11)
+            dg = ((p >> 5) & 0x3F) - ((prev >> 5) & 0x3F)
+            db = (p & 0x1F) - (prev & 0x1F)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                flush_literal()
+                out.append(TAG_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            else:
+                literal.append(p)
+                if len(literal) == MAX_RUN:
+                    flush_literal()
+        prev = p
+    flush_literal()
+    if run > 0:
+        out.append(TAG_RUN | (run - 1))
+    return bytes(out)
+
+
+def decode(data, count):
+    """Reference decoder, used to check the output."""
+    table = [0] * 64
+    prev = 0
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        tag = data[i]
+        i += 1
+        if tag & 0xC0 == TAG_INDEX:
+            prev = table[tag & 0x3F]
+            pixels.append(prev)
+        elif tag & 0xC0 == TAG_RUN:
+            pixels.extend([prev] * ((tag & 0x3F) + 1))
+        elif tag & 0xC0 == TAG_DIFF:
+            r = (prev >> 11) + ((tag >> 4) & 3) - 2
+            g = ((prev >> 5) & 0x3F) + ((tag >> 2) & 3) - 2
+            b = (prev & 0x1F) + (tag & 3) - 2
+            prev = r << 11 | g << 5 | b
+            table[pixel_hash(prev)] = prev
+            pixels.append(prev)
+        else:
+            for _ in range((tag & 0x3F) + 1):
+                prev = data[i] << 8 | data[i + 1]
+                i += 2
+                table[pixel_hash(prev)] = prev
+                pixels.append(prev)
+    return pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--image", help="Image file (png, jpg, bmp...)")
+    parser.add_argument("--c-array", help="C file with a raw RGB565 array")
+    parser.add_argument("--width", type=int, help="Width of the raw array in pixels")
+    parser.add_argument("--height", type=int, help="Height of the raw array in pixels")
+    parser.add_argument("--name", required=True, help="Name of the ili9341_image_t structure")
+    args = parser.parse_args()
+
+    if args.image:
+        width, height, pixels = read_image(args.image)
+    elif args.c_array and args.width and args.height:
+        width, height = args.width, args.height
+        pixels = read_c_array(args.c_array, width, height)
+    else:
+        parser.error("--image or --c-array, --width and --height are required")
+
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        sys.exit("encoding error")
+
+    print("/**")
+    print(" * @file %s.c" % args.name)
+    print(" * @brief %dx%d pixels image for ILI9341DrawImage(), %d bytes (%d bytes raw)." % (width, height, len(data), len(pixels) * 2))
+    print(" * @note Generated with firmware/tools/image_converter.py")
+    print(" */")
+    print()
+    print("/*==================[inclusions]=============================================*/")
+    print('#include "ili9341.h"')
+    print()
+    print("/*==================[internal data definition]===============================*/")
+    print("static const uint8_t %s_data[] = {" % args.name)
+    for i in range(0, len(data), 16):
+        print("\t" + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    print("};")
+    print()
+    print("/*==================[external data definition]===============================*/")
+    print("const ili9341_image_t %s = {" % args.name)
+    print("\t%d," % width)
+    print("\t%d," % height)
+    print("\t%s_data" % args.name)
+    print("};")
+    print()
+    print("/*==================[end of file]============================================*/")
+    print("%s: %d bytes, %.1f%% of raw" % (args.name, len(data), 100.0 * len(data) / (len(pixels) * 2)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
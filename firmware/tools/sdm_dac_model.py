@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+@file sdm_dac_model.py
+@brief Host model of the analog output (sigma-delta DAC) that reports the SNR of each
+configuration of AnalogOutputInitConfig().
+
+A full scale sine is generated as 16 bit values written at a steady update rate
+(as the waveform player and the signal generator do), reduced to 8 bits by the
+selected resolution mode, converted by the first order sigma-delta modulator
+of the ESP32-C6 at the SDM rate and filtered by an RC low pass filter:
+
+    python3 sdm_dac_model.py
+    python3 sdm_dac_model.py --update-rate 48000 --signal 1000 --cutoff 5000 --order 2
+
+The noise is whatever is left after the best fitting sine is removed from the
+filter output, so ripple, quantization noise and idle tones are all counted.
+Each mode is the same integer arithmetic as DacWrite16() in analog_io_mcu.c.
+"""
+
+import argparse
+import math
+
+MODES = ("DAC_8_BITS", "DAC_NOISE_SHAPING", "DAC_DITHER")
+
+
+class Quantizer:
+    """16 to 8 bit reduction of DacWrite16()."""
+
+    def __init__(self, mode):
+        self.mode = mode
+        self.error = 0
+        self.seed = 1
+
+    def dither(self):
+        s = self.seed
+        s ^= (s << 13) & 0xFFFFFFFF
+        s ^= s >> 17
+        s ^= (s << 5) & 0xFFFFFFFF
+        self.seed = s
+        return (s & 0xFF) + ((s >> 8) & 0xFF) - 255
+
+    def __call__(self, value):
+        if self.mode == "DAC_8_BITS":
+            return value >> 8
+        shaped = value + self.error
+        level = shaped
+        if self.mode == "DAC_DITHER":
+            level += self.dither()
+        level = min(max((level + 128) >> 8, 0), 255)
+        self.error = min(max(shaped - (level << 8), -256), 256)
+        return level
+
+
+def simulate(mode, sdm_rate, args):
+    """Returns the filtered output, sampled once per update period."""
+    quantizer = Quantizer(mode)
+    steps = sdm_rate // args.update_rate
+    alpha = 1.0 - math.exp(-2.0 * math.pi * args.cutoff / sdm_rate)
+    filters = [0.0] * args.order
+    accumulator = 0
+    out = []
+    for n in range(int(args.time * args.update_rate)):
+        phase = 2.0 * math.pi * args.signal * n / args.update_rate
+        value = int(32768 + args.amplitude * 32767 * math.sin(phase))
+        density = quantizer(value) - 128
+        for _ in range(steps):
+            # First order modulator: the duty cycle is (density + 128) / 256
+            accumulator += density + 128
+            bit = 1.0 if accumulator >= 256 else 0.0
+            if bit:
+                accumulator -= 256
+            x = bit
+            for i in range(args.order):
+                filters[i] += alpha * (x - filters[i])
+                x = filters[i]
+        out.append(x)
+    return out
+
+
+def snr(samples, args):
+    """Fits offset and sine at the signal frequency, returns SNR (dB)."""
+    start = len(samples) // 5  # filter settling
+    rows = []
+    for n in range(start, len(samples)):
+        phase = 2.0 * math.pi * args.signal * n / args.update_rate
+        rows.append((1.0, math.sin(phase), math.cos(phase), samples[n]))
+    # Normal equations of the 3 parameter least squares fit
+    a = [[sum(r[i] * r[j] for r in rows) for j in range(3)] for i in range(3)]
+    b = [sum(r[i] * r[3] for r in rows) for i in range(3)]
+    for i in range(3):
+        for j in range(i + 1, 3):
+            k = a[j][i] / a[i][i]
+            for m in range(3):
+                a[j][m] -= k * a[i][m]
+            b[j] -= k * b[i]
+    p = [0.0] * 3
+    for i in reversed(range(3)):
+        p[i] = (b[i] - sum(a[i][m] * p[m] for m in range(i + 1, 3))) / a[i][i]
+    noise = sum((r[3] - p[0] - p[1] * r[1] - p[2] * r[2]) ** 2 for r in rows) / len(rows)
+    signal = (p[1] ** 2 + p[2] ** 2) / 2.0
+    return 10.0 * math.log10(signal / noise) if noise > 0 else float("inf")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[2])
+    parser.add_argument("--sdm-rate", type=int, nargs="+", default=[1000000, 5000000],
+                        help="sigma-delta modulator rates (Hz)")
+    parser.add_argument("--update-rate", type=int, default=20000, help="rate of the 16 bit writes (Hz)")
+    parser.add_argument("--signal", type=float, default=100.0, help="sine frequency (Hz)")
+    parser.add_argument("--amplitude", type=float, default=0.9, help="sine amplitude (fraction of full scale)")
+    parser.add_argument("--cutoff", type=float, default=1000.0, help="RC filter cut-off frequency (Hz)")
+    parser.add_argument("--order", type=int, default=2, help="number of RC stages")
+    parser.add_argument("--time", type=float, default=0.1, help="simulated time (s)")
+    args = parser.parse_args()
+
+    print("%-18s %10s %10s %8s" % ("mode", "SDM (Hz)", "SNR (dB)", "ENOB"))
+    for sdm_rate in args.sdm_rate:
+        for mode in MODES:
+            result = snr(simulate(mode, sdm_rate, args), args)
+            print("%-18s %10d %10.1f %8.2f" % (mode, sdm_rate, result, (result - 1.76) / 6.02))
+
+
+if __name__ == "__main__":
+    main()